@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:51:48 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:00:51 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARITH_H
+# define ARITH_H
+
+# include "minishell.h"
+
+/*src/arith/arith.c*/
+void		arith_free(void *tree);
+int			arith_run(t_aeval *e, char *text, long long *result);
+
+/*src/arith/arith_lexer.c*/
+void		arith_next(t_aparse *p);
+int			arith_level(t_aparse *p);
+
+/*src/arith/arith_parser.c*/
+int			arith_node(t_aparse *p, int type, int op, int at);
+int			arith_binary(t_aparse *p, int level);
+
+/*src/arith/arith_parser_utils.c*/
+int			arith_perr(t_aparse *p, int error);
+int			arith_compound(t_aparse *p);
+int			arith_comma(t_aparse *p);
+
+/*src/arith/arith_eval.c*/
+long long	arith_fail(t_aeval *e, int error, int at);
+long long	arith_exec(t_aeval *e, int n);
+
+/*src/arith/arith_calc.c*/
+long long	arith_calc(t_aeval *e, t_anode *node, long long a, long long b);
+long long	arith_unop(int op, long long a);
+
+/*src/arith/arith_utils.c*/
+char		*arith_lltoa(long long n, char *buffer);
+int			arith_eval(t_tools *tools, char *text, int cache, long long *value);
+void		arith_error(char *text, int error, int at);
+long long	arith_get(t_aeval *e, char *name);
+
+#endif
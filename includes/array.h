@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:25:23 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARRAY_H
+# define ARRAY_H
+
+# include "minishell.h"
+
+/*src/array/array.c*/
+t_hash	*shell_arrays(void);
+t_array	*array_new(char *name, int assoc);
+int		array_put(t_array *array, long long index, char *value);
+
+/*src/array/array_list.c*/
+t_array	*array_find(char *name);
+int		array_length(t_array *array);
+char	**array_values(t_array *array, int keys);
+
+/*src/array/array_utils.c*/
+int		subscript_end(char *s, int i);
+int		array_assign_name(char *word);
+int		array_index(t_tools *tools, t_array *array, char *sub,
+			long long *index);
+char	*array_elem(t_tools *tools, t_array *array, char *sub);
+char	*array_first(char *name);
+
+/*src/array/array_assign.c*/
+int		array_assign(t_tools *tools, char **words);
+
+#endif
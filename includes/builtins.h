@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 17:08:45 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,6 +17,18 @@
 
 /*src/builtins/builtins.c*/
 int			(*is_builtin(char *str))(t_tools *tools, t_parser *parser);
+int			run_builtin(t_tools *tools, t_parser *parser);
+
+/*src/builtins/builtin_output.c*/
+t_output	*builtin_output(void);
+void		output_flush(char *str, size_t len);
+void		output_write(char *str, size_t len);
+void		output_str(char *str);
+
+/*src/builtins/builtin_capture.c*/
+void		capture_write(t_capture *capture, char *str, size_t len);
+void		capture_begin(t_capture *saved);
+char		*capture_end(t_capture *saved, size_t *len);
 
 /*src/builtins/cmd_cd/cmd_cd.c*/
 int			cd_no_path(t_tools *tools, t_parser *command);
@@ -82,6 +94,114 @@ int			check_exit_args(t_parser *parser);
 void		exit_err(int err, char *str);
 int			cmd_exit(t_tools *tools, t_parser *parser);
 
+/*src/builtins/cmd_exec.c*/
+int			cmd_exec(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_source.c*/
+int			cmd_source(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_loop.c*/
+int			cmd_break(t_tools *tools, t_parser *command);
+int			cmd_continue(t_tools *tools, t_parser *command);
+int			cmd_true(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_function/cmd_function.c*/
+int			cmd_function(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_function/cmd_function_utils.c*/
+t_hash		*shell_functions(void);
+void		func_define(t_node *node);
+int			cmd_return(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_alias/cmd_alias.c*/
+int			cmd_alias(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_alias/cmd_alias_utils.c*/
+t_hash		*shell_aliases(void);
+int			alias_err(char *cmd, char *arg, char *msg);
+int			cmd_unalias(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_let.c*/
+int			cmd_let(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_declare/cmd_declare.c*/
+int			cmd_declare(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_declare/cmd_declare_utils.c*/
+int			declare_print(char *name, t_array *array);
+int			declare_list(void);
+
+/*src/builtins/cmd_mapfile.c*/
+int			cmd_mapfile(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_printf/cmd_printf.c*/
+void		printf_err(t_printf *pf, char *arg, char *msg);
+int			cmd_printf(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_printf/cmd_printf_utils1.c*/
+int			printf_put(t_printf *pf, char *str, size_t len);
+void		printf_format(t_printf *pf, char *spec, ...);
+int			printf_escape(t_printf *pf, char *str, int in_b);
+char		*printf_expand(t_printf *pf, char *str);
+
+/*src/builtins/cmd_printf/cmd_printf_utils2.c*/
+int			printf_directive(t_printf *pf, char *fmt);
+
+/*src/builtins/cmd_printf/cmd_printf_utils3.c*/
+char		*printf_next_arg(t_printf *pf);
+unsigned long long	printf_integer(t_printf *pf, char *arg, int is_signed);
+long double	printf_float(t_printf *pf, char *arg);
+char		*printf_text(t_printf *pf, char conv, char *arg);
+
+/*src/builtins/cmd_printf/cmd_printf_utils4.c*/
+char		*printf_quote(char *str);
+
+/*src/builtins/cmd_read/cmd_read.c*/
+int			cmd_read(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_read/cmd_read_utils1.c*/
+int			read_char(int fd, char *c);
+void		read_sync(void);
+int			read_input(t_read *rd);
+
+/*src/builtins/cmd_read/cmd_read_utils2.c*/
+int			read_push(t_read *rd, char c, int escaped);
+void		read_assign(t_tools *tools, t_read *rd, char **vars);
+
+/*src/builtins/cmd_test/cmd_test.c*/
+int			test_err(t_test *test, char *arg, char *msg);
+int			test_term(t_test *test);
+int			test_and(t_test *test);
+int			test_or(t_test *test);
+int			cmd_test(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_test/cmd_test_utils1.c*/
+int			test_primary(t_test *test);
+int			test_number(t_test *test, char *str, long long *n);
+
+/*src/builtins/cmd_test/cmd_test_utils2.c*/
+int			timespec_newer(struct timespec *a, struct timespec *b);
+int			is_test_binary(char *str);
+int			test_binary(t_test *test);
+
+/*src/builtins/cmd_parallel/cmd_parallel.c*/
+int			parallel_err(char *str, char *msg);
+int			parallel_options(t_parallel *par, char **str, int *i);
+int			parallel_args(t_parallel *par, char **str);
+void		parallel_free(t_parallel *par);
+int			cmd_parallel(t_tools *tools, t_parser *command);
+
+/*src/builtins/cmd_parallel/cmd_parallel_utils1.c*/
+char		*replace_braces(char *word, char *arg);
+char		**parallel_argv(char **cmd, char *arg);
+
+/*src/builtins/cmd_parallel/cmd_parallel_utils2.c*/
+void		parallel_child(t_tools *tools, t_parallel *par, t_job *job);
+void		parallel_spawn(t_tools *tools, t_parallel *par, t_job *job);
+void		parallel_finish(t_parallel *par, t_job *job, int status);
+void		parallel_reap(t_parallel *par);
+void		parallel_run(t_tools *tools, t_parallel *par);
+
 /*src/builtins/pwd.c*/
 int			cmd_pwd(t_tools *tools, t_parser *command);
 
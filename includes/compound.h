@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:17:52 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:30:11 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMPOUND_H
+# define COMPOUND_H
+
+# include "minishell.h"
+
+/*src/compound/compound.c*/
+t_node	*ctl_list(t_ctl *ctl, char *stops);
+void	compound_line(t_tools *tools, char *line);
+
+/*src/compound/compound_lexer.c*/
+void	ctl_next(t_ctl *ctl);
+
+/*src/compound/compound_lexer_utils.c*/
+int		ctl_word_end(char *s, int i);
+int		ctl_is(t_ctl *ctl, char *word);
+char	*ctl_text(t_ctl *ctl);
+
+/*src/compound/compound_parser.c*/
+t_node	*ctl_command(t_ctl *ctl);
+t_node	*ctl_pipeline(t_ctl *ctl);
+
+/*src/compound/compound_parser_utils.c*/
+void	ctl_error(t_ctl *ctl);
+int		ctl_want(t_ctl *ctl, int type);
+int		ctl_expect(t_ctl *ctl, char *word);
+void	ctl_skip(t_ctl *ctl);
+int		ctl_stop(t_ctl *ctl, char *stops);
+
+/*src/compound/compound_keywords.c*/
+t_node	*ctl_if(t_ctl *ctl);
+t_node	*ctl_loop(t_ctl *ctl);
+t_node	*ctl_for(t_ctl *ctl);
+
+/*src/compound/compound_case.c*/
+t_node	*ctl_case(t_ctl *ctl);
+
+/*src/compound/compound_cond.c*/
+t_node	*ctl_cond(t_ctl *ctl);
+
+/*src/compound/compound_function.c*/
+int		ctl_is_func(t_ctl *ctl);
+t_node	*ctl_compound(t_ctl *ctl);
+t_node	*ctl_group(t_ctl *ctl);
+t_node	*ctl_function(t_ctl *ctl);
+
+/*src/compound/compound_alias.c*/
+int		ctl_aliases(t_ctl *ctl);
+
+/*src/compound/compound_node.c*/
+t_node	*node_new(t_ctl *ctl, int type);
+t_node	*node_simple(t_ctl *ctl, int start, int end);
+void	node_append(t_node **head, t_node *node);
+void	node_body(t_ctl *ctl, t_node *node);
+void	node_free(t_node *node);
+
+/*src/compound/compound_time.c*/
+t_node	*ctl_time(t_ctl *ctl);
+void	exec_time(t_tools *tools, t_node *node);
+
+/*src/compound/compound_exec.c*/
+int		compound_stop(t_tools *tools);
+void	exec_compound(t_tools *tools, t_node *node);
+void	exec_node(t_tools *tools, t_node *node);
+void	exec_list(t_tools *tools, t_node *node);
+
+/*src/compound/compound_loop.c*/
+void	exec_loop(t_tools *tools, t_node *node);
+void	exec_for(t_tools *tools, t_node *node);
+void	exec_case(t_tools *tools, t_node *node);
+
+/*src/compound/compound_words.c*/
+char	**expand_words(t_tools *tools, char *text);
+char	**for_words(t_tools *tools, char **raw);
+char	*expand_word(t_tools *tools, char *text);
+char	*case_pattern(char *raw);
+
+/*src/compound/compound_redir.c*/
+void	exec_redirected(t_tools *tools, t_node *node);
+
+/*src/compound/compound_pipe.c*/
+void	std_rebase(t_tools *tools);
+void	exec_pipe(t_tools *tools, t_node *node);
+
+#endif
@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cond.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:40:18 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:45:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COND_H
+# define COND_H
+
+# include "minishell.h"
+
+/*src/cond/cond.c*/
+int		cond_err(t_cond *cond, char *word);
+int		cond_term(t_cond *cond, int run);
+int		cond_and(t_cond *cond, int run);
+int		cond_or(t_cond *cond, int run);
+void	exec_cond(t_tools *tools, t_node *node);
+
+/*src/cond/cond_ops.c*/
+char	*cond_expand(t_cond *cond, char *raw);
+int		cond_primary(t_cond *cond, int run);
+
+/*src/cond/cond_regex.c*/
+void	regex_cache_clear(void);
+regex_t	*regex_get(char *pattern);
+
+/*src/cond/cond_match.c*/
+int		cond_pattern(t_cond *cond, char *s, char *op, char *raw);
+int		cond_regex(t_cond *cond, char *s, char *raw);
+
+#endif
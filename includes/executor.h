@@ -6,7 +6,7 @@
 /*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/27 18:21:29 by ftomaz-c         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,12 +18,12 @@
 /*src/executor/executor.c*/
 void	exec_path(t_tools *tools, char **cmd_args, char **envp);
 int		simple_exec_and_buitlins(t_tools *tools, t_parser *parser);
-void	execute_cmd(t_tools *tools, t_parser *parser, int index);
+void	execute_cmd(t_tools *tools, t_parser *parser);
 void	set_and_execute(t_tools *tools, t_parser *parser);
 int		executor(t_tools *tools);
 
 /*src/executor/executor_utils1.c*/
-void	broadcast_signal(t_tools *tools, int num_pids, int signal);
+void	get_status(int *status);
 void	free_and_exit(t_tools *tools, int status);
 void	exec_err(t_tools *tools, int err, char *str);
 void	wait_status(t_tools *tools, int pid, int *status);
@@ -34,13 +34,22 @@ void	execute_simple_cmd(t_tools *tools, t_parser *parser, char **env);
 int		is_executable(t_tools *tools, char **cmd_args, char **envp);
 int		is_valid(t_parser *parser);
 
+/*src/executor/executor_utils3.c*/
+int		exec_indexed(t_tools *tools, char **cmd_args, char **envp);
+int		command_not_found(t_tools *tools, t_parser *parser);
+void	close_fds(t_tools *tools);
+char	**prefix_apply(t_tools *tools, t_parser *parser);
+
 /*src/executor/redirections.c*/
-int		set_stdin(t_tools *tools, t_parser *parser, int fd);
-t_lexer	*set_input(t_tools *tools, t_parser *parser, t_lexer *redirection,
-			int fd);
-void	set_stdout(t_parser *parser, int fd);
+int		set_stdin(t_parser *parser, int fd);
+t_lexer	*set_input(t_parser *parser, t_lexer *redirection, int fd);
+int		set_stdout(t_parser *parser, int fd);
 t_lexer	*set_output(t_parser *parser, t_lexer *redirection, int fd);
-void	redirection(t_tools *tools, t_parser *parser, int *index);
+void	redirection(t_parser *parser);
+
+/*src/executor/redirections_dup.c*/
+t_lexer	*set_dup(t_parser *parser, t_lexer *amp, int fd);
+t_lexer	*set_here_string(t_parser *parser, t_lexer *word, int fd);
 
 /*src/executor/redirections_utils.c*/
 void	set_stdin_flag(t_parser *parser, t_lexer *redirections);
@@ -49,15 +58,27 @@ int		get_digits_token(t_lexer *current);
 int		set_fd(t_lexer *current, t_parser *parser);
 void	std_err(int err, char *str);
 
+/*src/executor/saved_fds.c*/
+void	save_fd(t_saved_fds *saved, int fd);
+void	save_redirected_fds(t_parser *parser, t_saved_fds *saved);
+void	restore_fds(t_saved_fds *saved);
+void	run_builtin_redirected(t_tools *tools, t_parser *parser);
+
+/*src/executor/prefix_assign.c*/
+int		env_index(char **env, char *entry);
+char	**prefix_env(char **env, char **assigns);
+void	prefix_restore(t_tools *tools, char **saved, char **assigns);
+
 /*src/executor/pipex.c*/
 void	pipex_dup_and_close(int close_fd, int dup_fd, int dup_fd2);
 void	minishell_pipex(t_tools *tools, t_parser *parser, int *index);
 
 /*src/executor/here_doc.c*/
-void	get_here_doc(t_tools *tools, int fd[2], char *delimiter);
-void	here_doc(t_tools *tools, char *delimiter);
-void	status_heredoc(t_tools *tools, int *status, int pid);
-void	get_status(int *status);
+int		get_here_doc(t_tools *tools, int fd, t_lexer *delimiter);
+int		here_doc(t_tools *tools, t_lexer *delimiter);
+int		parser_heredocs(t_tools *tools, t_parser *parser);
+int		collect_heredocs(t_tools *tools);
+void	close_heredocs(t_parser *parser);
 
 /*src/executor/child_signals.c*/
 void	eof_sig_msg(t_tools *tools, char *line, char *delimiter);
@@ -6,7 +6,7 @@
 /*   By: ftomazc < ftomaz-c@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/26 18:23:47 by ftomazc          ###   ########.fr       */
+/*   Updated: 2026/10/19 02:27:39 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,7 +20,7 @@ int		check_conditions_expander(char *str, int position);
 void	expand_split(char **env, char **split);
 char	*merge_list_of_strings(char **list, char *separator);
 char	*expand_tilde(char *str, char *home_var);
-char	*expander(char **env, char **list, t_tools *tools);
+char	*expander(char **list, t_tools *tools);
 
 /*src/expander/expander_utils_1.c*/
 int		is_expandable(char **list, int *index);
@@ -42,4 +42,76 @@ void	init_expander(t_expander *expander);
 int		realloc_split(t_expander *expander, char *str, int i);
 char	**split_expander(char *str);
 
+/*src/expander/expander_params.c*/
+int		is_special_param(char c);
+char	*param_value(char **env, char *var);
+
+/*src/expander/expander_dynamic.c*/
+t_dynamic	*shell_dynamic(void);
+char		*dynamic_value(char **env, char *var);
+
+/*src/expander/expander_arith.c*/
+int		expand_arith(t_tools *tools, char **word, int start);
+
+/*src/expander/expander_subst.c*/
+char	*subst_run(t_tools *tools, char *text);
+
+/*src/expander/expander_subst_pure.c*/
+int		subst_pure(char *text);
+
+/*src/expander/expander_subst_utils.c*/
+char	*subst_quote(char *s, char quote);
+int		word_splice(char **word, int start, int end, char *text);
+int		expand_command(t_tools *tools, char **word, int i, char quote);
+int		expand_substs(t_tools *tools, char **word, int procs);
+
+/*src/expander/expander_herestring.c*/
+void	herestring_quote(char **list, int index);
+
+/*src/expander/expander_procsub.c*/
+t_procsubs	*proc_substs(void);
+int			expand_procsub(t_tools *tools, char **word, int i);
+void		procsub_end(t_tools *tools, int mark);
+
+/*src/expander/expander_brace.c*/
+int		expand_brace(t_tools *tools, char **word, int i, char quote);
+
+/*src/expander/expander_brace_utils.c*/
+int		brace_parse(char *text, t_brace *brace);
+char	*brace_join(char **list, int each);
+void	brace_error(char *text, int len);
+
+/*src/expander/expander_glob.c*/
+int		glob_word(char *raw, t_lexer **lexer);
+
+/*src/expander/expander_glob_utils1.c*/
+char	*glob_pattern(char *raw, int escape);
+int		glob_magic(char *raw);
+int		glob_slash(char *raw, int i);
+int		glob_add(t_glob *glob, char *path);
+void	glob_free(t_glob *glob);
+
+/*src/expander/expander_glob_utils2.c*/
+char	*glob_join(char *prefix, char *name);
+int		glob_skip(t_gstep *step, char *name);
+int		glob_isdir(char *path, struct dirent *entry);
+int		glob_redirected(t_lexer *lexer);
+DIR		*glob_opendir(char *prefix);
+
+/*src/expander/expander_walk.c*/
+void	glob_star(t_glob *out, char *prefix, t_gstep *step);
+
+/*src/expander/expander_walk_utils1.c*/
+int		walk_push(t_walk *walk, int id, char *path);
+char	*walk_pop(t_walk *walk, int id);
+int		walk_count(t_walk *walk, int delta);
+
+/*src/expander/expander_walk_utils2.c*/
+void	walk_dir(t_worker *worker, char *path);
+void	*walk_worker(void *arg);
+
+/*src/expander/expander_heredoc.c*/
+int		heredoc_var(t_tools *tools, char *line, int i, char **result);
+char	*expand_heredoc_line(t_tools *tools, char *line);
+
 #endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 14:37:13 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:49:07 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,11 +16,11 @@
 # include "minishell.h"
 
 /*src/lexer/lexer.c*/
-void	add_word_to_node(char *word, t_lexer **lexer);
+t_lexer	*add_word_to_node(char *word, t_lexer **lexer);
 void	add_token_to_node(char token, t_lexer **lexer);
 void	add_line_to_lexer_struct(char **line_split, t_lexer **lexer);
 int		lex_line(char	**line_split_quotes, t_tools *tools);
-int		lexer(char *line, t_tools *tools);
+int		lexer(char **line_split_quotes, t_tools *tools);
 
 /*src/lexer/lexer_utils1.c*/
 int		invalid_redir_syntax(char **list);
@@ -45,11 +45,18 @@ int		valid_syntax(t_lexer *lexer, t_tools *tools);
 
 /*src/lexer/lexer_split.c*/
 void	syntax_err(char token);
-void	handle_characters(char *s, int *i, int *start, int flag);
+void	handle_characters(char *s, int *i, int flag);
 char	**create_split(char *s, char **split, int nwords, int flag);
 char	**lexer_split(char *s, int flag);
 int		check_token_flag(char *str, int i, int flag, int position);
 
+/*src/lexer/lexer_subst.c*/
+int		quoted_end(char *s, int i);
+int		procsub_start(char *s, int i);
+int		bracket_start(char *s, int i);
+int		subst_end(char *s, int i);
+int		word_skip(char *s, int i);
+
 /*src/lexer/lexer_split_utils.c*/
 int		paired_quote(char *str, int i, char ch, int flag);
 void	handle_white_spaces_and_quotes(char *s, int *i, int *start, int flag);
@@ -6,14 +6,14 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 18:50:29 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:30:11 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef MINISHELL_H
 # define MINISHELL_H
 
-# define _POSIX_C_SOURCE 199309L
+# define _GNU_SOURCE
 
 # ifndef SA_RESTART
 #  define SA_RESTART 0x10000000
@@ -23,15 +23,25 @@
 # include <unistd.h>
 # include <stdio.h>
 # include <stdlib.h>
+# include <string.h>
 # include <readline/readline.h>
 # include <readline/history.h>
 # include <sys/types.h>
 # include <sys/stat.h>
 # include <sys/wait.h>
+# include <sys/resource.h>
+# include <sys/mman.h>
+# include <sys/uio.h>
+# include <time.h>
 # include <fcntl.h>
 # include <limits.h>
 # include <stdbool.h>
 # include <dirent.h>
+# include <errno.h>
+# include <stdarg.h>
+# include <pthread.h>
+# include <sys/syscall.h>
+# include <regex.h>
 # include "../libft/includes/libft.h"
 # include "structs.h"
 # include "utils.h"
@@ -40,18 +50,45 @@
 # include "parser.h"
 # include "builtins.h"
 # include "executor.h"
+# include "compound.h"
+# include "arith.h"
+# include "array.h"
+# include "cond.h"
 
 t_status	*global_status(void);
 
+/*src/minishell/completion.c*/
+void		setup_completion(t_tools *tools);
+
 /*src/minishell/minishell.c*/
 void		interactive_mode(t_tools *tools, char *line);
 void		non_interactive_mode(t_tools *tools, char *line);
+void		run_words(t_tools *tools, char **words);
+void		execute_line(t_tools *tools, char *line);
 void		minishell(t_tools *tools, char *line);
 
 /*src/minishell/signals.c*/
 void		react_sig_handler(int sig);
 void		handle_sigaction(void);
 
+/*src/minishell/script.c*/
+char		**split_lines(char *data);
+char		*join_lines(char **lines, int start, int end, size_t *len);
+int			script_here_doc(t_tools *tools, int fd, t_lexer *delimiter);
+
+/*src/minishell/time.c*/
+void		time_start(t_timer *timer);
+void		wait_usage(t_tools *tools, pid_t pid, int *status);
+void		time_usage(t_times *times, t_timer *timer);
+void		time_report(t_tools *tools);
+
+/*src/minishell/time_format.c*/
+void		time_fraction(char *buf, long micro, int precision);
+void		time_fixed(char *buf, long micro, int precision, int longfmt);
+int			time_counter(char *buf, char c, t_times *times);
+int			time_directive(char *buf, char *fmt, t_times *times);
+void		time_print(char *fmt, t_times *times);
+
 /*src/minishell/tools.c*/
 void		handle_shlvl(char *pre_lvl, char **new_lvl, size_t lvl);
 void		update_env(t_tools *tools);
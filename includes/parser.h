@@ -6,7 +6,7 @@
 /*   By: ftomazc < ftomaz-c@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/23 18:07:44 by ftomazc          ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,6 +24,11 @@ int			parser(t_tools *tools);
 
 /*src/parser/parser_redir.c*/
 t_lexer		*add_redirection(t_lexer *current, t_parser *node, int *start);
+t_lexer		*add_redirection_operator(t_lexer *current, t_parser *node,
+				int *start);
+
+/*src/parser/parser_assign.c*/
+int			parser_assigns(t_parser *node);
 
 /*src/parser/parser_utils.c*/
 void		count_heredocs(t_parser *parser);
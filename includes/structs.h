@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 14:22:04 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:30:11 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,12 +17,174 @@
 # define LESS_LESS 2
 # define GREAT 3
 # define GREAT_GREAT 4 
+# define LESS_LESS_LESS 5
+
+# define FILE_CHUNK 65536
+
+# define OUTPUT_BUFFER 65536
+
+# define BUILTINS 28
+# define TEST_UNARY "bcdefgGhkLnNOprsStuwxz"
+# define PRINTF_ESCAPES "abefnrtv\\\"'"
+# define PRINTF_VALUES "\a\b\033\f\n\r\t\v\\\"'"
+# define PRINTF_SAFE "_-+.,/:=@%^"
+
+# define MAX_FDS 1024
+# define READ_FDS 10
+# define READ_BUFFER 65536
+# define READ_UNKNOWN 0
+# define READ_CHUNK 1
+# define READ_BYTE 2
+# define MAX_SOURCE_DEPTH 64
+# define MAX_FUNC_DEPTH 1000
+# define MAX_ALIAS_DEPTH 32
+# define ALIAS_INVALID " \t\n;|&<>()/$`\\'\""
+# define HASH_SIZE 64
+# define MAX_SAVED_FDS 16
+# define MAX_PROC_SUBSTS 64
+# define ARRAY_SIZE 16
+# define REGEX_CACHE_SIZE 16
+# define SAVED_FD_BASE 100
+
+# define ARITH_OPS "<<>>**<=>===!=&&||++--* / % + - < > & ^ | = ? : , ! ~ ( ) "
+# define ARITH_LEVELS "77:665510  9998866432        "
+# define ARITH_COMPOUND "234789"
+# define ARITH_NLEVELS 11
+# define ARITH_MAX_DEPTH 64
+# define ARITH_CACHE_SIZE 512
+# define ARITH_NUMBER 32
+# define A_SHL 0
+# define A_SHR 1
+# define A_POW 2
+# define A_LE 3
+# define A_GE 4
+# define A_EQ 5
+# define A_NE 6
+# define A_AND 7
+# define A_OR 8
+# define A_INC 9
+# define A_DEC 10
+# define A_MUL 11
+# define A_DIV 12
+# define A_MOD 13
+# define A_ADD 14
+# define A_SUB 15
+# define A_LT 16
+# define A_GT 17
+# define A_BAND 18
+# define A_XOR 19
+# define A_BOR 20
+# define A_SET 21
+# define A_QUEST 22
+# define A_COLON 23
+# define A_COMMA 24
+# define A_NOT 25
+# define A_BNOT 26
+# define A_LPAREN 27
+# define A_RPAREN 28
+# define AT_EOF 0
+# define AT_NUM 1
+# define AT_NAME 2
+# define AT_OP 3
+# define AT_BAD 4
+# define AN_NUM 0
+# define AN_VAR 1
+# define AN_UNARY 2
+# define AN_PRE 3
+# define AN_POST 4
+# define AN_BINARY 5
+# define AN_COND 6
+# define AN_ASSIGN 7
+# define ARITH_ESYNTAX 1
+# define ARITH_EOPERAND 2
+# define ARITH_EDIV 3
+# define ARITH_EEXP 4
+# define ARITH_EASSIGN 5
+# define ARITH_ECOLON 6
+# define ARITH_EBASE 7
+# define ARITH_EPAREN 8
+# define ARITH_EDEPTH 9
+# define ARITH_EOPERATOR 10
+# define ARITH_EQUIET 11
+
+# define CTL_WORD 1
+# define CTL_NEWLINE 2
+# define CTL_SEMI 3
+# define CTL_DSEMI 4
+# define CTL_PIPE 5
+# define CTL_LPAREN 6
+# define CTL_RPAREN 7
+# define CTL_OP 8
+# define CTL_EOF 9
+# define MAX_PENDING_HEREDOCS 16
+# define CTL_METACHARS " \t\n;|&<>()"
+# define SUBST_QUOTED "\"$\\`|&;<>()"
+# define REGEX_SPECIAL ".[]()*+?{}|^$\\"
+# define CTL_RESERVED "then elif else fi do done esac }"
+# define CTL_COMPOUND "{ if while until for case [["
+
+# define NODE_SIMPLE 1
+# define NODE_IF 2
+# define NODE_WHILE 3
+# define NODE_UNTIL 4
+# define NODE_FOR 5
+# define NODE_CASE 6
+# define NODE_ITEM 7
+# define NODE_PIPE 8
+# define NODE_GROUP 9
+# define NODE_FUNC 10
+# define NODE_COND 11
+# define NODE_TIME 12
+
+# define GOP_END 0
+# define GOP_SET 1
+# define GOP_STAR 2
+# define GLOB_MAX_THREADS 64
+# define WALK_BUFFER 32768
+# define WALK_OPEN (O_RDONLY | O_DIRECTORY | O_CLOEXEC)
+
+# define TIME_BUFFER 1024
+# define TIME_FORMAT "\nreal\t%3lR\nuser\t%3lU\nsys\t%3lS\nrss\t%MK\ncsw\t%w/%c"
+# define TIME_POSIX_FORMAT "real %2R\nuser %2U\nsys %2S"
 
 typedef struct s_status
 {
 	int	nbr;
+	int	sigint;
 }	t_status;
 
+typedef struct s_params
+{
+	char	**argv;
+}	t_params;
+
+typedef struct s_dynamic
+{
+	struct timespec		start;
+	unsigned long long	seed;
+	pid_t				pid;
+}	t_dynamic;
+
+typedef struct s_timer
+{
+	int				posix;
+	struct timespec	start;
+	struct rusage	self;
+	struct rusage	children;
+	long			maxrss;
+}	t_timer;
+
+typedef struct s_times
+{
+	long	real;
+	long	user;
+	long	sys;
+	long	cpu;
+	long	maxrss;
+	long	nvcsw;
+	long	nivcsw;
+}	t_times;
+
 typedef struct s_tools
 {
 	char			empty_env;
@@ -42,8 +204,16 @@ typedef struct s_tools
 	char			**lines;
 	int				original_stdin;
 	int				original_stdout;
+	char			exec_fds[MAX_FDS];
+	int				sourcing;
+	int				loop_depth;
+	int				breaks;
+	int				continues;
+	int				func_depth;
+	int				returns;
 	pid_t			*pids;
 	int				fd[2];
+	t_timer			timer;
 	struct s_lexer	*lexer;
 	struct s_parser	*parser;
 }	t_tools;
@@ -52,6 +222,8 @@ typedef struct s_lexer
 {
 	char			*words;
 	char			token;
+	char			quoted;
+	char			assign;
 	int				index;
 	struct s_lexer	*next;
 	struct s_lexer	*pre;
@@ -60,9 +232,13 @@ typedef struct s_lexer
 typedef struct s_parser
 {
 	char			**str;
+	char			**assigns;
+	int				nb_assigns;
 	int				(*builtin)(struct s_tools *, struct s_parser *);
 	int				nb_redirections;
 	int				nb_heredocs;
+	int				*heredocs;
+	int				heredoc_index;
 	char			*stdin_file_name;
 	char			*stdout_file_name;
 	int				stdin_flag;
@@ -82,6 +258,346 @@ typedef struct s_expander
 	int				start;
 }	t_expander;
 
+typedef struct s_path_dir
+{
+	char			*name;
+	struct timespec	mtime;
+	int				scanned;
+	int				complete;
+	int				count;
+	char			**entries;
+}	t_path_dir;
+
+typedef struct s_path_index
+{
+	char		**path;
+	int			ndirs;
+	t_path_dir	*dirs;
+	int			count;
+	char		**names;
+}	t_path_index;
+
+typedef struct s_entry
+{
+	char			*key;
+	void			*value;
+	struct s_entry	*next;
+}	t_entry;
+
+typedef struct s_hash
+{
+	t_entry	**buckets;
+	int		size;
+	int		count;
+	void	(*del)(void *);
+}	t_hash;
+
+typedef struct s_gop
+{
+	int				type;
+	unsigned char	set[32];
+}	t_gop;
+
+typedef struct s_glob
+{
+	char	**paths;
+	int		count;
+	int		size;
+}	t_glob;
+
+typedef struct s_gstep
+{
+	t_gop	*ops;
+	char	*lit;
+	int		star;
+	int		dir_only;
+}	t_gstep;
+
+typedef struct s_anode
+{
+	int			type;
+	int			op;
+	long long	value;
+	char		*name;
+	int			at;
+	int			a;
+	int			b;
+	int			c;
+}	t_anode;
+
+typedef struct s_arith
+{
+	t_anode	*nodes;
+	int		count;
+	int		size;
+	int		root;
+}	t_arith;
+
+typedef struct s_aparse
+{
+	char		*s;
+	int			pos;
+	int			type;
+	int			op;
+	int			tok;
+	int			len;
+	long long	value;
+	int			error;
+	int			at;
+	t_arith		*tree;
+}	t_aparse;
+
+typedef struct s_array
+{
+	int		assoc;
+	char	**items;
+	int		size;
+	int		count;
+	t_hash	map;
+}	t_array;
+
+typedef struct s_brace
+{
+	char	op;
+	char	*name;
+	char	*sub;
+}	t_brace;
+
+typedef struct s_cond
+{
+	t_tools	*tools;
+	char	**words;
+	int		count;
+	int		pos;
+	int		error;
+}	t_cond;
+
+typedef struct s_regentry
+{
+	char	*pattern;
+	regex_t	*re;
+}	t_regentry;
+
+typedef struct s_regcache
+{
+	t_regentry	entries[REGEX_CACHE_SIZE];
+	int			count;
+}	t_regcache;
+
+typedef struct s_aeval
+{
+	t_tools	*tools;
+	t_arith	*tree;
+	int		depth;
+	int		error;
+	int		at;
+	int		cache;
+}	t_aeval;
+
+typedef struct s_gopts
+{
+	int		disabled;
+	char	**env;
+}	t_gopts;
+
+typedef struct s_dirent64
+{
+	unsigned long long	d_ino;
+	long long			d_off;
+	unsigned short		d_reclen;
+	unsigned char		d_type;
+	char				d_name[];
+}	t_dirent64;
+
+typedef struct s_wqueue
+{
+	t_glob			items;
+	int				head;
+	pthread_mutex_t	lock;
+}	t_wqueue;
+
+typedef struct s_walk
+{
+	t_wqueue		*queues;
+	t_glob			*found;
+	char			*prefix;
+	int				threads;
+	int				pending;
+	int				dir_only;
+	int				root_fd;
+	pthread_mutex_t	lock;
+}	t_walk;
+
+typedef struct s_worker
+{
+	t_walk		*walk;
+	pthread_t	thread;
+	int			id;
+	int			fd;
+}	t_worker;
+
+typedef struct s_capture
+{
+	int		on;
+	char	*data;
+	size_t	len;
+	size_t	size;
+}	t_capture;
+
+typedef struct s_output
+{
+	size_t		len;
+	char		data[OUTPUT_BUFFER];
+	t_capture	capture;
+}	t_output;
+
+typedef struct s_procsubs
+{
+	int		count;
+	int		fd[MAX_PROC_SUBSTS];
+	pid_t	pid[MAX_PROC_SUBSTS];
+}	t_procsubs;
+
+typedef struct s_saved_fds
+{
+	int	count;
+	int	fd[MAX_SAVED_FDS];
+	int	copy[MAX_SAVED_FDS];
+}	t_saved_fds;
+
+typedef struct s_job
+{
+	pid_t	pid;
+	int		id;
+	int		out;
+	int		err;
+	char	*arg;
+}	t_job;
+
+typedef struct s_parallel
+{
+	int		jobs;
+	char	**cmd;
+	char	**args;
+	int		nargs;
+	int		next;
+	int		running;
+	int		failed;
+	int		stop;
+	t_job	*slots;
+}	t_parallel;
+
+typedef struct s_source
+{
+	char			**lines;
+	int				line_count;
+	int				nint_mode;
+	int				pipes;
+	struct s_parser	*parser;
+	char			**argv;
+}	t_source;
+
+typedef struct s_test
+{
+	char	*name;
+	char	**argv;
+	int		argc;
+	int		pos;
+	int		error;
+}	t_test;
+
+typedef struct s_read_buf
+{
+	int		mode;
+	size_t	start;
+	size_t	end;
+	char	data[READ_BUFFER];
+}	t_read_buf;
+
+typedef struct s_read
+{
+	int		fd;
+	int		raw;
+	int		delim;
+	long	nchars;
+	char	*ifs;
+	char	*line;
+	char	*esc;
+	size_t	len;
+	size_t	size;
+}	t_read;
+
+typedef struct s_printf
+{
+	char	*out;
+	size_t	len;
+	size_t	size;
+	char	**args;
+	int		argc;
+	int		pos;
+	int		stop;
+	int		status;
+}	t_printf;
+
+typedef struct s_spec
+{
+	char	flags[8];
+	int		width;
+	int		prec;
+	char	conv;
+	char	c[64];
+}	t_spec;
+
+typedef struct s_node
+{
+	int				type;
+	int				refs;
+	char			*text;
+	char			**words;
+	char			**body;
+	char			*redir;
+	struct s_node	*cond;
+	struct s_node	*list;
+	struct s_node	*other;
+	struct s_node	*next;
+}	t_node;
+
+typedef struct s_scope
+{
+	t_saved_fds	fds;
+	int			std[2];
+	char		exec_fds[MAX_FDS];
+}	t_scope;
+
+typedef struct s_call
+{
+	struct s_parser	*parser;
+	char			**argv;
+	int				pipes;
+	int				loop_depth;
+	int				std[2];
+}	t_call;
+
+typedef struct s_ctl
+{
+	char	*src;
+	int		pos;
+	int		type;
+	int		start;
+	int		end;
+	int		last_end;
+	int		incomplete;
+	int		error;
+	int		want_delim;
+	int		ndelims;
+	char	*delims[MAX_PENDING_HEREDOCS];
+	int		body_start;
+	int		body_end;
+	char	*aliased[MAX_ALIAS_DEPTH];
+	int		naliases;
+	int		alias_next;
+}	t_ctl;
+
 typedef struct s_builtin
 {
 	char	*name;
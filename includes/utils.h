@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 19:06:02 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,6 +18,11 @@
 /*src/utils/error.c*/
 void		error_check(int argc, char **argv);
 
+/*src/utils/files.c*/
+int			anon_file(void);
+int			copy_fd(int from, int to);
+char		*read_fd(int fd, size_t *len);
+
 /*src/utils/history.c*/
 void		write_in_history_file(char **line, int fd, char *file_path);
 void		add_history_file(t_tools *tools, char *line, char *file_name);
@@ -30,6 +35,16 @@ void		treat_line(char ***line_array, char *line);
 void		add_line(char *line, char ***line_array, int fd, char *file_path);
 int			check_line_count(int line_count, int fd);
 
+/*src/utils/path_index.c*/
+t_path_index	*path_index(void);
+void		path_index_update(char **path);
+
+/*src/utils/path_index_utils.c*/
+int			path_index_reset(t_path_index *index, char **path);
+void		path_index_merge(t_path_index *index);
+void		path_index_free(void);
+int			path_index_find(char **path, char *name, char **full);
+
 /*src/utils/print.c*/
 void		print_lexer(t_tools *tools);
 void		print_parser_redirections(t_parser *parser);
@@ -61,4 +76,36 @@ int			check_empty_line(char *line);
 int			ft_isspace_special(int c, int flag);
 void		ft_lstaddback_lexer(t_lexer **lst, t_lexer *new);
 
+
+/*src/utils/utils4.c*/
+char		**list_dup(char **list, int start, int end);
+char		**list_add(char **list, char *str);
+char		*append_len(char *str, char *part, size_t len);
+int			compare_names(const void *a, const void *b);
+t_params	*shell_params(void);
+
+/*src/utils/utils5.c*/
+int			is_valid_name(char *str);
+int			is_assignment(char *word);
+void		set_var(t_tools *tools, char *name, char *value);
+t_gopts		*glob_options(void);
+
+/*src/utils/hash.c*/
+unsigned int	hash_key(char *key);
+t_entry		*hash_find(t_hash *hash, char *key);
+void		*hash_get(t_hash *hash, char *key);
+int			hash_set(t_hash *hash, char *key, void *value);
+
+/*src/utils/hash_utils.c*/
+int			hash_del(t_hash *hash, char *key);
+void		hash_clear(t_hash *hash);
+char		**hash_keys(t_hash *hash);
+
+/*src/utils/match.c*/
+int			match_pattern(char *p, char *s);
+
+/*src/utils/glob_match.c*/
+t_gop		*glob_compile(char *p);
+int			glob_match(t_gop *op, char *s);
+
 #endif
\ No newline at end of file
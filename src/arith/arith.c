@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:53:41 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:00:51 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/arith.h"
+
+/**
+ * @brief Returns the cache of parse trees, keyed by expression text.
+ * 
+ * @return The cache.
+ */
+static t_hash	*arith_cache(void)
+{
+	static t_hash	cache = {NULL, 0, 0, arith_free};
+
+	return (&cache);
+}
+
+/**
+ * @brief Frees a parse tree.
+ * 
+ * @param tree The tree.
+ */
+void	arith_free(void *tree)
+{
+	t_arith	*arith;
+	int		i;
+
+	arith = tree;
+	if (!arith)
+		return ;
+	i = 0;
+	while (i < arith->count)
+		free(arith->nodes[i++].name);
+	free(arith->nodes);
+	free(arith);
+}
+
+/**
+ * @brief Parses an expression into a tree.
+ * 
+ * An empty expression is 0. Errors are printed here.
+ * 
+ * @param text The expression.
+ * 
+ * @return The tree, or NULL on error.
+ */
+static t_arith	*arith_compile(char *text)
+{
+	t_aparse	p;
+
+	p = (t_aparse){text, 0, AT_EOF, 0, 0, 0, 0, 0, 0,
+		ft_calloc(1, sizeof(t_arith))};
+	if (!p.tree)
+		return (NULL);
+	arith_next(&p);
+	if (p.type == AT_EOF && !p.error)
+		p.tree->root = arith_node(&p, AN_NUM, 0, 0);
+	else
+		p.tree->root = arith_comma(&p);
+	if (p.type != AT_EOF)
+		arith_perr(&p, ARITH_ESYNTAX);
+	if (!p.error)
+		return (p.tree);
+	arith_error(text, p.error, p.at);
+	arith_free(p.tree);
+	return (NULL);
+}
+
+/**
+ * @brief Parses an expression, or finds its tree in the cache.
+ * 
+ * The cache is emptied when full, which keeps it simple and still serves
+ * the loops it is meant for.
+ * 
+ * @param text The expression.
+ * @param cache Whether the text may be cached.
+ * 
+ * @return The tree, or NULL on error.
+ */
+static t_arith	*arith_lookup(char *text, int cache)
+{
+	t_hash	*hash;
+	t_arith	*tree;
+
+	if (!cache)
+		return (arith_compile(text));
+	hash = arith_cache();
+	tree = hash_get(hash, text);
+	if (tree)
+		return (tree);
+	tree = arith_compile(text);
+	if (!tree)
+		return (NULL);
+	if (hash->count >= ARITH_CACHE_SIZE)
+		hash_clear(hash);
+	if (!hash_set(hash, text, tree))
+	{
+		arith_free(tree);
+		return (NULL);
+	}
+	return (tree);
+}
+
+/**
+ * @brief Evaluates an expression one level deeper than another.
+ * 
+ * @param e The evaluation state of the outer expression.
+ * @param text The expression.
+ * @param result Where to store the value.
+ * 
+ * @return 1 on success, 0 on error, which is printed.
+ */
+int	arith_run(t_aeval *e, char *text, long long *result)
+{
+	t_aeval	run;
+
+	if (e->depth >= ARITH_MAX_DEPTH)
+	{
+		arith_error(text, ARITH_EDEPTH, 0);
+		return (0);
+	}
+	run = (t_aeval){e->tools, arith_lookup(text, e->cache), e->depth + 1,
+		0, 0, e->cache};
+	if (!run.tree)
+		return (0);
+	*result = arith_exec(&run, run.tree->root);
+	if (run.error)
+		arith_error(text, run.error, run.at);
+	if (!run.cache)
+		arith_free(run.tree);
+	return (!run.error);
+}
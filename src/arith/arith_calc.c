@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_calc.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:53:41 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:00:51 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/arith.h"
+
+/**
+ * @brief Raises a number to a power by repeated squaring.
+ * 
+ * @param e The evaluation state.
+ * @param node The operator node.
+ * @param a The base.
+ * @param b The exponent.
+ * 
+ * @return The power, wrapped to 64 bits.
+ */
+static long long	arith_pow(t_aeval *e, t_anode *node, long long a,
+	long long b)
+{
+	unsigned long long	result;
+	unsigned long long	base;
+
+	if (b < 0)
+		return (arith_fail(e, ARITH_EEXP, node->at));
+	result = 1;
+	base = a;
+	while (b)
+	{
+		if (b & 1)
+			result *= base;
+		base *= base;
+		b >>= 1;
+	}
+	return (result);
+}
+
+/**
+ * @brief Applies a shift, a bitwise operator or a comparison.
+ * 
+ * Shift counts are taken modulo 64, as the processor does.
+ * 
+ * @param op The operator.
+ * @param a The left operand.
+ * @param b The right operand.
+ * 
+ * @return The result.
+ */
+static long long	arith_bits(int op, long long a, long long b)
+{
+	if (op == A_SHL)
+		return ((unsigned long long)a << (b & 63));
+	if (op == A_SHR)
+		return (a >> (b & 63));
+	if (op == A_BAND)
+		return (a & b);
+	if (op == A_XOR)
+		return (a ^ b);
+	if (op == A_BOR)
+		return (a | b);
+	if (op == A_LE)
+		return (a <= b);
+	if (op == A_GE)
+		return (a >= b);
+	if (op == A_LT)
+		return (a < b);
+	if (op == A_GT)
+		return (a > b);
+	if (op == A_EQ)
+		return (a == b);
+	return (a != b);
+}
+
+/**
+ * @brief Applies a binary operator.
+ * 
+ * Arithmetic wraps around on overflow instead of being undefined, and
+ * dividing the smallest number by -1 gives it back.
+ * 
+ * @param e The evaluation state.
+ * @param node The operator node.
+ * @param a The left operand.
+ * @param b The right operand.
+ * 
+ * @return The result.
+ */
+long long	arith_calc(t_aeval *e, t_anode *node, long long a, long long b)
+{
+	unsigned long long	ua;
+	unsigned long long	ub;
+
+	ua = a;
+	ub = b;
+	if ((node->op == A_DIV || node->op == A_MOD) && b == 0)
+		return (arith_fail(e, ARITH_EDIV, node->at));
+	if (node->op == A_DIV && b == -1)
+		return (0 - ua);
+	if (node->op == A_MOD && b == -1)
+		return (0);
+	if (node->op == A_DIV)
+		return (a / b);
+	if (node->op == A_MOD)
+		return (a % b);
+	if (node->op == A_POW)
+		return (arith_pow(e, node, a, b));
+	if (node->op == A_MUL)
+		return (ua * ub);
+	if (node->op == A_ADD)
+		return (ua + ub);
+	if (node->op == A_SUB)
+		return (ua - ub);
+	return (arith_bits(node->op, a, b));
+}
+
+/**
+ * @brief Applies a unary operator.
+ * 
+ * @param op The operator.
+ * @param a The operand.
+ * 
+ * @return The result.
+ */
+long long	arith_unop(int op, long long a)
+{
+	if (op == A_SUB)
+		return (0 - (unsigned long long)a);
+	if (op == A_NOT)
+		return (!a);
+	if (op == A_BNOT)
+		return (~a);
+	return (a);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_eval.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:53:41 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:00:51 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/arith.h"
+
+/**
+ * @brief Records an evaluation error.
+ * 
+ * Only the first error is kept, and evaluation unwinds from there.
+ * 
+ * @param e The evaluation state.
+ * @param error The error code.
+ * @param at Where the error is in the text.
+ * 
+ * @return 0, the value of a failed expression.
+ */
+long long	arith_fail(t_aeval *e, int error, int at)
+{
+	if (!e->error)
+	{
+		e->error = error;
+		e->at = at;
+	}
+	return (0);
+}
+
+/**
+ * @brief Evaluates a binary operator.
+ * 
+ * "&&" and "||" skip their right operand when the left one decides the
+ * result, as the comma only keeps the right one.
+ * 
+ * @param e The evaluation state.
+ * @param node The operator node.
+ * 
+ * @return The value of the operation.
+ */
+static long long	arith_binop(t_aeval *e, t_anode *node)
+{
+	long long	a;
+	long long	b;
+
+	a = arith_exec(e, node->a);
+	if (e->error)
+		return (0);
+	if (node->op == A_AND && !a)
+		return (0);
+	if (node->op == A_OR && a)
+		return (1);
+	b = arith_exec(e, node->b);
+	if (e->error)
+		return (0);
+	if (node->op == A_COMMA)
+		return (b);
+	if (node->op == A_AND || node->op == A_OR)
+		return (b != 0);
+	return (arith_calc(e, node, a, b));
+}
+
+/**
+ * @brief Evaluates an assignment or an increment of a variable.
+ * 
+ * @param e The evaluation state.
+ * @param node The assignment, prefix or postfix node.
+ * 
+ * @return The new value, or the old one for a postfix operator.
+ */
+static long long	arith_update(t_aeval *e, t_anode *node)
+{
+	long long	old;
+	long long	value;
+	char		buffer[ARITH_NUMBER];
+
+	old = 0;
+	if (node->type == AN_ASSIGN)
+		value = arith_exec(e, node->a);
+	else
+	{
+		old = arith_get(e, node->name);
+		value = (unsigned long long)old + 1 - 2 * (node->op == A_DEC);
+	}
+	if (!e->error && node->type == AN_ASSIGN && node->op != A_SET)
+		value = arith_calc(e, node, arith_get(e, node->name), value);
+	if (e->error)
+		return (0);
+	set_var(e->tools, node->name, arith_lltoa(value, buffer));
+	if (node->type == AN_POST)
+		return (old);
+	return (value);
+}
+
+/**
+ * @brief Evaluates a node of a parse tree.
+ * 
+ * @param e The evaluation state.
+ * @param n The index of the node.
+ * 
+ * @return The value of the node, or 0 once an error was recorded.
+ */
+long long	arith_exec(t_aeval *e, int n)
+{
+	t_anode		*node;
+	long long	value;
+
+	node = &e->tree->nodes[n];
+	if (node->type == AN_NUM)
+		return (node->value);
+	if (node->type == AN_VAR)
+		return (arith_get(e, node->name));
+	if (node->type == AN_UNARY)
+		return (arith_unop(node->op, arith_exec(e, node->a)));
+	if (node->type == AN_BINARY)
+		return (arith_binop(e, node));
+	if (node->type != AN_COND)
+		return (arith_update(e, node));
+	value = arith_exec(e, node->a);
+	if (e->error)
+		return (0);
+	if (value)
+		return (arith_exec(e, node->b));
+	return (arith_exec(e, node->c));
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_lexer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:53:41 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:00:51 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/arith.h"
+
+/**
+ * @brief Returns the value of a digit in a base.
+ * 
+ * Bases up to 36 ignore case. Larger bases take the lowercase letters,
+ * then the uppercase ones, '@' and '_'.
+ * 
+ * @param c The character.
+ * @param base The base.
+ * 
+ * @return The value, or 64 if the character is no digit.
+ */
+static int	arith_digit(char c, int base)
+{
+	if (ft_isdigit(c))
+		return (c - '0');
+	if (c >= 'a' && c <= 'z')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'Z' && base <= 36)
+		return (c - 'A' + 10);
+	if (c >= 'A' && c <= 'Z')
+		return (c - 'A' + 36);
+	if (c == '@')
+		return (62);
+	if (c == '_')
+		return (63);
+	return (64);
+}
+
+/**
+ * @brief Reads a number token.
+ * 
+ * A leading 0 makes an octal number and a leading 0x a hexadecimal one,
+ * while "base#digits" takes any base from 2 to 64.
+ * 
+ * @param p The arithmetic parser.
+ */
+static void	arith_number(t_aparse *p)
+{
+	long long	base;
+	int			digit;
+
+	base = 10 - 2 * (p->s[p->pos] == '0');
+	if (base == 8 && (p->s[p->pos + 1] == 'x' || p->s[p->pos + 1] == 'X'))
+		base = 16;
+	p->pos += 2 * (base == 16);
+	p->value = 0;
+	while (arith_digit(p->s[p->pos], 64) < 64 || p->s[p->pos] == '#')
+	{
+		digit = arith_digit(p->s[p->pos], base);
+		if (p->s[p->pos] == '#' && base == 10 && p->value >= 2
+			&& p->value <= 64)
+		{
+			base = p->value;
+			p->value = 0;
+		}
+		else if (digit >= base)
+			arith_perr(p, ARITH_EBASE);
+		else
+			p->value = (unsigned long long)p->value * base + digit;
+		p->pos++;
+	}
+}
+
+/**
+ * @brief Reads an operator token.
+ * 
+ * Operators are looked up in ARITH_OPS, two characters per entry, so the
+ * first entry that matches is the longest operator. Any other character
+ * is an error.
+ * 
+ * @param p The arithmetic parser.
+ */
+static void	arith_op(t_aparse *p)
+{
+	char	*ops;
+	char	*s;
+	int		k;
+
+	ops = ARITH_OPS;
+	s = p->s + p->pos;
+	k = 0;
+	while (ops[k * 2] && (ops[k * 2] != s[0]
+			|| (ops[k * 2 + 1] != ' ' && ops[k * 2 + 1] != s[1])))
+		k++;
+	p->op = k;
+	p->type = AT_BAD;
+	if (!ops[k * 2])
+	{
+		arith_perr(p, ARITH_EOPERATOR);
+		return ;
+	}
+	p->type = AT_OP;
+	p->pos += 1 + (ops[k * 2 + 1] != ' ');
+}
+
+/**
+ * @brief Moves the arithmetic parser to the next token.
+ * 
+ * At the end of the text, the start of the last token is kept for error
+ * messages.
+ * 
+ * @param p The arithmetic parser.
+ */
+void	arith_next(t_aparse *p)
+{
+	char	*s;
+
+	s = p->s;
+	while (ft_isspace(s[p->pos]))
+		p->pos++;
+	p->type = AT_EOF;
+	if (!s[p->pos])
+		return ;
+	p->tok = p->pos;
+	if (ft_isdigit(s[p->pos]))
+	{
+		p->type = AT_NUM;
+		arith_number(p);
+	}
+	else if (ft_isalpha(s[p->pos]) || s[p->pos] == '_')
+	{
+		while (ft_isalnum(s[p->pos]) || s[p->pos] == '_')
+			p->pos++;
+		p->len = p->pos - p->tok;
+		p->type = AT_NAME;
+	}
+	else
+		arith_op(p);
+}
+
+/**
+ * @brief Returns the precedence level of the current token.
+ * 
+ * @param p The arithmetic parser.
+ * 
+ * @return The level, from 0 for "||" to ARITH_NLEVELS - 1 for "**", or -1
+ * if the token is no binary operator.
+ */
+int	arith_level(t_aparse *p)
+{
+	if (p->type != AT_OP || ARITH_LEVELS[p->op] == ' ' || arith_compound(p))
+		return (-1);
+	return (ARITH_LEVELS[p->op] - '0');
+}
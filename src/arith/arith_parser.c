@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_parser.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:53:41 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:00:51 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/arith.h"
+
+/**
+ * @brief Appends a node to the tree being parsed.
+ * 
+ * Nodes live in one array that doubles when full, and refer to each other
+ * by index.
+ * 
+ * @param p The arithmetic parser.
+ * @param type The type of the node.
+ * @param op The operator of the node.
+ * @param at Where the node starts in the text, for error messages.
+ * 
+ * @return The index of the node, or -1 on allocation error.
+ */
+int	arith_node(t_aparse *p, int type, int op, int at)
+{
+	t_arith	*tree;
+	t_anode	*nodes;
+
+	tree = p->tree;
+	if (tree->count == tree->size)
+	{
+		nodes = ft_realloc(tree->nodes, sizeof(t_anode) * (tree->size * 2
+					+ 8), sizeof(t_anode) * tree->size);
+		if (!nodes)
+			return (arith_perr(p, ARITH_EQUIET));
+		tree->nodes = nodes;
+		tree->size = tree->size * 2 + 8;
+	}
+	tree->nodes[tree->count] = (t_anode){type, op, 0, NULL, at, -1, -1, -1};
+	return (tree->count++);
+}
+
+/**
+ * @brief Parses a number or a variable.
+ * 
+ * A variable preceded or followed by "++" or "--" becomes an update of
+ * the variable.
+ * 
+ * @param p The arithmetic parser.
+ * @param pre The prefix operator, or -1.
+ * @param at Where the node starts in the text.
+ * 
+ * @return The index of the node, or -1 on error.
+ */
+static int	arith_leaf(t_aparse *p, int pre, int at)
+{
+	t_anode	*node;
+	int		n;
+
+	n = arith_node(p, AN_NUM + (p->type == AT_NAME), pre, at);
+	if (n < 0)
+		return (-1);
+	node = &p->tree->nodes[n];
+	node->value = p->value;
+	if (p->type == AT_NAME)
+		node->name = ft_substr(p->s, p->tok, p->len);
+	if (p->type == AT_NAME && !node->name)
+		return (arith_perr(p, ARITH_EQUIET));
+	node->type += (AN_PRE - AN_VAR) * (pre >= 0);
+	arith_next(p);
+	if (node->type != AN_VAR || p->type != AT_OP
+		|| (p->op != A_INC && p->op != A_DEC))
+		return (n);
+	node->type = AN_POST;
+	node->op = p->op;
+	arith_next(p);
+	return (n);
+}
+
+/**
+ * @brief Parses an operand, or an expression in parentheses.
+ * 
+ * @param p The arithmetic parser.
+ * 
+ * @return The index of the node, or -1 on error.
+ */
+static int	arith_primary(t_aparse *p)
+{
+	int	n;
+
+	if (p->type == AT_NUM || p->type == AT_NAME)
+		return (arith_leaf(p, -1, p->tok));
+	if (p->type != AT_OP || p->op != A_LPAREN)
+		return (arith_perr(p, ARITH_EOPERAND));
+	arith_next(p);
+	n = arith_comma(p);
+	if (n >= 0 && (p->type != AT_OP || p->op != A_RPAREN))
+		return (arith_perr(p, ARITH_EPAREN));
+	arith_next(p);
+	return (n);
+}
+
+/**
+ * @brief Parses a unary operator and its operand.
+ * 
+ * "++" and "--" update a variable that follows them. Before anything
+ * else, they are two signs, so "--5" is 5.
+ * 
+ * @param p The arithmetic parser.
+ * 
+ * @return The index of the node, or -1 on error.
+ */
+static int	arith_prefix(t_aparse *p)
+{
+	int	op;
+	int	at;
+	int	n;
+	int	m;
+
+	op = p->op;
+	if (p->type != AT_OP || (op != A_ADD && op != A_SUB && op != A_NOT
+			&& op != A_BNOT && op != A_INC && op != A_DEC))
+		return (arith_primary(p));
+	at = p->tok;
+	arith_next(p);
+	if ((op == A_INC || op == A_DEC) && p->type == AT_NAME)
+		return (arith_leaf(p, op, at));
+	n = arith_prefix(p);
+	m = 1 + (op == A_INC || op == A_DEC);
+	op += (A_ADD - A_INC) * (m == 2);
+	while (n >= 0 && m--)
+	{
+		at = arith_node(p, AN_UNARY, op, at);
+		if (at >= 0)
+			p->tree->nodes[at].a = n;
+		n = at;
+	}
+	return (n);
+}
+
+/**
+ * @brief Parses the binary operators of one precedence level.
+ * 
+ * Levels run from "||" up to "**". Each level parses its operands at the
+ * level above it, and "**" associates to the right.
+ * 
+ * @param p The arithmetic parser.
+ * @param level The precedence level.
+ * 
+ * @return The index of the node, or -1 on error.
+ */
+int	arith_binary(t_aparse *p, int level)
+{
+	int	left;
+	int	right;
+	int	n;
+
+	if (level == ARITH_NLEVELS)
+		return (arith_prefix(p));
+	left = arith_binary(p, level + 1);
+	while (left >= 0 && arith_level(p) == level)
+	{
+		n = arith_node(p, AN_BINARY, p->op, 0);
+		arith_next(p);
+		if (n >= 0)
+			p->tree->nodes[n].at = p->tok;
+		right = arith_binary(p, level + (level < ARITH_NLEVELS - 1));
+		if (n < 0 || right < 0)
+			return (-1);
+		p->tree->nodes[n].a = left;
+		p->tree->nodes[n].b = right;
+		left = n;
+	}
+	return (left);
+}
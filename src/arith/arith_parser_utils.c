@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_parser_utils.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:53:41 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:00:51 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/arith.h"
+
+/**
+ * @brief Records a parse error at the current token.
+ * 
+ * Only the first error is kept.
+ * 
+ * @param p The arithmetic parser.
+ * @param error The error code.
+ * 
+ * @return -1, the index of no node.
+ */
+int	arith_perr(t_aparse *p, int error)
+{
+	if (!p->error)
+	{
+		p->error = error;
+		p->at = p->tok;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Tells whether the current token is a compound assignment.
+ * 
+ * Compound assignments are lexed as their binary operator, followed by an
+ * '=' that is not part of "==".
+ * 
+ * @param p The arithmetic parser.
+ * 
+ * @return 1 if it is, 0 otherwise.
+ */
+int	arith_compound(t_aparse *p)
+{
+	return (p->type == AT_OP && ft_strchr(ARITH_COMPOUND,
+			ARITH_LEVELS[p->op]) && p->s[p->pos] == '='
+		&& p->s[p->pos + 1] != '=');
+}
+
+/**
+ * @brief Parses a conditional expression.
+ * 
+ * @param p The arithmetic parser.
+ * 
+ * @return The index of the node, or -1 on error.
+ */
+static int	arith_cond(t_aparse *p)
+{
+	int	n;
+	int	c;
+
+	c = arith_binary(p, 0);
+	if (c < 0 || p->type != AT_OP || p->op != A_QUEST)
+		return (c);
+	n = arith_node(p, AN_COND, 0, p->tok);
+	if (n < 0)
+		return (-1);
+	p->tree->nodes[n].a = c;
+	arith_next(p);
+	c = arith_comma(p);
+	if (c >= 0 && (p->type != AT_OP || p->op != A_COLON))
+		return (arith_perr(p, ARITH_ECOLON));
+	p->tree->nodes[n].b = c;
+	arith_next(p);
+	if (c >= 0)
+		c = arith_cond(p);
+	p->tree->nodes[n].c = c;
+	if (c < 0)
+		return (-1);
+	return (n);
+}
+
+/**
+ * @brief Parses an assignment, plain or compound.
+ * 
+ * Assignments associate to the right. The variable node becomes the
+ * assignment node, and op holds the binary operator of a compound
+ * assignment.
+ * 
+ * @param p The arithmetic parser.
+ * 
+ * @return The index of the node, or -1 on error.
+ */
+static int	arith_assign(t_aparse *p)
+{
+	int	left;
+	int	right;
+	int	op;
+
+	left = arith_cond(p);
+	if (left < 0 || (!arith_compound(p)
+			&& (p->type != AT_OP || p->op != A_SET)))
+		return (left);
+	if (p->tree->nodes[left].type != AN_VAR)
+		return (arith_perr(p, ARITH_EASSIGN));
+	op = p->op;
+	p->pos += arith_compound(p);
+	arith_next(p);
+	p->tree->nodes[left].at = p->tok;
+	right = arith_assign(p);
+	if (right < 0)
+		return (-1);
+	p->tree->nodes[left].type = AN_ASSIGN;
+	p->tree->nodes[left].op = op;
+	p->tree->nodes[left].a = right;
+	return (left);
+}
+
+/**
+ * @brief Parses a list of expressions separated by commas.
+ * 
+ * This is the whole grammar: the value of the list is its last element.
+ * 
+ * @param p The arithmetic parser.
+ * 
+ * @return The index of the node, or -1 on error.
+ */
+int	arith_comma(t_aparse *p)
+{
+	int	left;
+	int	right;
+	int	n;
+
+	left = arith_assign(p);
+	while (left >= 0 && p->type == AT_OP && p->op == A_COMMA)
+	{
+		n = arith_node(p, AN_BINARY, A_COMMA, p->tok);
+		arith_next(p);
+		right = arith_assign(p);
+		if (n < 0 || right < 0)
+			return (-1);
+		p->tree->nodes[n].a = left;
+		p->tree->nodes[n].b = right;
+		left = n;
+	}
+	return (left);
+}
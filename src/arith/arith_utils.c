@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:53:42 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:18:39 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/arith.h"
+
+/**
+ * @brief Writes a number in decimal.
+ * 
+ * @param n The number.
+ * @param buffer A buffer of ARITH_NUMBER characters.
+ * 
+ * @return The start of the number in the buffer.
+ */
+char	*arith_lltoa(long long n, char *buffer)
+{
+	unsigned long long	u;
+	int					i;
+
+	u = n;
+	if (n < 0)
+		u = 0 - u;
+	i = ARITH_NUMBER - 1;
+	buffer[i] = '\0';
+	while (u || i == ARITH_NUMBER - 1)
+	{
+		buffer[--i] = '0' + u % 10;
+		u /= 10;
+	}
+	if (n < 0)
+		buffer[--i] = '-';
+	return (buffer + i);
+}
+
+/**
+ * @brief Evaluates an arithmetic expression.
+ * 
+ * Only expressions whose text is the same on every run, without any
+ * expansion in them, should be cached.
+ * 
+ * @param tools The tools struct.
+ * @param text The expression.
+ * @param cache Whether the parse tree may be cached.
+ * @param value Where to store the value.
+ * 
+ * @return 1 on success, 0 on error, which is printed.
+ */
+int	arith_eval(t_tools *tools, char *text, int cache, long long *value)
+{
+	*value = 0;
+	return (arith_run(&(t_aeval){tools, NULL, 0, 0, 0, cache}, text, value));
+}
+
+/**
+ * @brief Returns the message of an arithmetic error.
+ * 
+ * @param error The error code.
+ * 
+ * @return The message.
+ */
+static char	*arith_message(int error)
+{
+	static char	*messages[] = {"", "syntax error in expression",
+		"syntax error: operand expected", "division by 0",
+		"exponent less than 0", "attempted assignment to non-variable",
+		"`:' expected for conditional expression",
+		"value too great for base", "missing `)'",
+		"expression recursion level exceeded",
+		"syntax error: invalid arithmetic operator"};
+
+	return (messages[error]);
+}
+
+/**
+ * @brief Prints an arithmetic error.
+ * 
+ * The expression is printed without its leading blanks, followed by the
+ * text from the token the error was found at.
+ * 
+ * @param text The expression.
+ * @param error The error code.
+ * @param at Where the error is in the text.
+ */
+void	arith_error(char *text, int error, int at)
+{
+	if (error == ARITH_EQUIET)
+		return ;
+	while (ft_isspace(*text) && at > 0)
+	{
+		text++;
+		at--;
+	}
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(text, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putstr_fd(arith_message(error), STDERR_FILENO);
+	ft_putstr_fd(" (error token is \"", STDERR_FILENO);
+	ft_putstr_fd(text + at, STDERR_FILENO);
+	ft_putstr_fd("\")\n", STDERR_FILENO);
+}
+
+/**
+ * @brief Returns the value of a variable.
+ * 
+ * A plain decimal value is read directly. Anything else is evaluated as
+ * an expression in turn, so "010" is octal and "y+1" follows y. Those
+ * nested trees are not cached, as values change all the time.
+ * 
+ * @param e The evaluation state.
+ * @param name The variable name.
+ * 
+ * @return The value, or 0 if the variable is unset or empty.
+ */
+long long	arith_get(t_aeval *e, char *name)
+{
+	char		*value;
+	long long	result;
+	int			i;
+
+	value = dynamic_value(e->tools->env, name);
+	if (!value)
+		return (0);
+	result = 0;
+	i = 0;
+	while (ft_isdigit(value[i]))
+		i++;
+	if (!value[i] && !(value[0] == '0' && value[1]))
+		result = ft_atoll(value);
+	else if (!arith_run(&(t_aeval){e->tools, NULL, e->depth, 0, 0, 0},
+		value, &result))
+		arith_fail(e, ARITH_EQUIET, 0);
+	free(value);
+	return (result);
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:23:49 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/array.h"
+
+/**
+ * @brief Frees an array, as the del function of the table of arrays.
+ * 
+ * @param ptr The array.
+ */
+static void	array_free(void *ptr)
+{
+	t_array	*array;
+
+	array = ptr;
+	while (array->items && array->count > 0)
+		free(array->items[--array->count]);
+	free(array->items);
+	hash_clear(&array->map);
+	free(array);
+}
+
+/**
+ * @brief Returns the table of arrays.
+ * 
+ * Names map to their arrays. Indexed arrays keep their elements in a
+ * vector, with NULL for the unset ones. Associative arrays keep them in a
+ * table of their own, so a lookup costs the same whatever their size.
+ * 
+ * @return Pointer to the table. It lives for the whole run of the shell.
+ */
+t_hash	*shell_arrays(void)
+{
+	static t_hash	arrays = {NULL, 0, 0, array_free};
+
+	return (&arrays);
+}
+
+/**
+ * @brief Creates an empty array, replacing any array by that name.
+ * 
+ * @param name The name, or NULL for an array that is not registered yet.
+ * @param assoc 1 for an associative array, 0 for an indexed one.
+ * 
+ * @return The array, or NULL on allocation error.
+ */
+t_array	*array_new(char *name, int assoc)
+{
+	t_array	*array;
+
+	array = ft_calloc(1, sizeof(t_array));
+	if (!array)
+		return (NULL);
+	array->assoc = assoc;
+	array->map.del = free;
+	if (name && !hash_set(shell_arrays(), name, array))
+	{
+		array_free(array);
+		return (NULL);
+	}
+	return (array);
+}
+
+/**
+ * @brief Makes room in an indexed array for an index.
+ * 
+ * The vector at least doubles when it has to grow, so filling an array
+ * one element at a time costs amortized constant time per element.
+ * 
+ * @param array The array.
+ * @param index The index.
+ * 
+ * @return 1 on success, 0 on allocation error or for an index too large.
+ */
+static int	array_grow(t_array *array, long long index)
+{
+	char	**items;
+	int		size;
+
+	if (index < array->size)
+		return (1);
+	if (index >= INT_MAX / 2)
+		return (0);
+	size = array->size * 2 + ARRAY_SIZE;
+	if (size <= index)
+		size = index + 1;
+	items = ft_calloc(size, sizeof(char *));
+	if (!items)
+		return (0);
+	if (array->items)
+		ft_memcpy(items, array->items, array->count * sizeof(char *));
+	free(array->items);
+	array->items = items;
+	array->size = size;
+	return (1);
+}
+
+/**
+ * @brief Sets an element of an indexed array.
+ * 
+ * @param array The array.
+ * @param index The index, not negative.
+ * @param value The value, which the array takes over. NULL is an
+ * allocation error.
+ * 
+ * @return 1 on success, 0 on allocation error or for an index too large.
+ */
+int	array_put(t_array *array, long long index, char *value)
+{
+	if (!value || !array_grow(array, index))
+	{
+		free(value);
+		return (0);
+	}
+	free(array->items[index]);
+	array->items[index] = value;
+	if (index >= array->count)
+		array->count = index + 1;
+	return (1);
+}
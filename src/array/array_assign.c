@@ -0,0 +1,194 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_assign.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:24:45 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/array.h"
+
+/**
+ * @brief Assigns a "[subscript]=value" element.
+ * 
+ * The subscript and the value are expanded like the word of a for loop,
+ * without filename expansion.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param array The array.
+ * @param raw The raw element, from its opening bracket.
+ * @param end Index of the closing bracket in raw.
+ * 
+ * @return 1 on success, 0 on error.
+ */
+static int	assign_element(t_tools *tools, t_array *array, char *raw, int end)
+{
+	long long	index;
+	char		*sub;
+	char		*value;
+	int			done;
+
+	sub = ft_substr(raw, 1, end - 1);
+	value = expand_word(tools, sub);
+	free(sub);
+	sub = value;
+	value = expand_word(tools, raw + end + 2);
+	done = 0;
+	if (sub && value && array->assoc)
+		done = hash_set(&array->map, sub, value);
+	else if (sub && value && array_index(tools, array, sub, &index))
+	{
+		done = array_put(array, index, value);
+		value = NULL;
+	}
+	if (!done)
+		free(value);
+	free(sub);
+	return (done);
+}
+
+/**
+ * @brief Appends the expansion of a raw element to an indexed array.
+ * 
+ * An unquoted element may expand to several words, each of which becomes
+ * an element.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param array The array.
+ * @param raw The raw element.
+ * 
+ * @return 1 on success, 0 on error.
+ */
+static int	assign_words(t_tools *tools, t_array *array, char *raw)
+{
+	char	**words;
+	int		done;
+	int		i;
+
+	words = expand_words(tools, raw);
+	if (!words)
+		return (0);
+	done = 1;
+	i = 0;
+	while (done && words[i])
+		done = array_put(array, array->count, ft_strdup(words[i++]));
+	free_list(words);
+	return (done);
+}
+
+/**
+ * @brief Assigns the elements of a "(...)" list.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param array The array, already emptied unless the list is appended.
+ * @param list The list, parentheses included. The closing one is cut off
+ * while the list is split.
+ * 
+ * @return 1 on success, 0 on error.
+ */
+static int	assign_list(t_tools *tools, t_array *array, char *list)
+{
+	char	**raw;
+	int		done;
+	int		end;
+	int		i;
+
+	list[ft_strlen(list) - 1] = '\0';
+	raw = lexer_split(list + 1, 0);
+	list[ft_strlen(list)] = ')';
+	done = 1;
+	i = 0;
+	while (done && raw && raw[i])
+	{
+		end = subscript_end(raw[i], 0);
+		if (raw[i][0] == '[' && end > 1 && raw[i][end + 1] == '=')
+			done = assign_element(tools, array, raw[i], end);
+		else if (array->assoc)
+			ft_putendl_fd("minishell: must use subscript when assigning "
+				"associative array", STDERR_FILENO);
+		else
+			done = assign_words(tools, array, raw[i]);
+		i++;
+	}
+	if (raw)
+		free_list(raw);
+	return (done);
+}
+
+/**
+ * @brief Runs one array assignment.
+ * 
+ * "name=(...)" replaces the array, keeping its kind, "name+=(...)" adds
+ * to it and "name[subscript]=value" sets one element. An array that does
+ * not exist yet is created as an indexed one. A replacing list is built
+ * aside, so it may still refer to the old elements.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param word The raw assignment.
+ * 
+ * @return 1 on success, 0 on error.
+ */
+static int	assign_word(t_tools *tools, char *word)
+{
+	t_array	*array;
+	char	*name;
+	int		len;
+	int		done;
+
+	len = array_assign_name(word);
+	name = ft_substr(word, 0, len);
+	if (!name)
+		return (0);
+	array = array_find(name);
+	if (word[len] == '=')
+		array = array_new(NULL, array && array->assoc);
+	else if (!array)
+		array = array_new(name, 0);
+	done = (array != NULL);
+	if (done && word[len] == '[')
+		done = assign_element(tools, array, word + len,
+				subscript_end(word, len) - len);
+	else if (done)
+		done = assign_list(tools, array, word + len + 1 + (word[len] == '+'));
+	if (array && word[len] == '=' && !(done
+			&& hash_set(shell_arrays(), name, array)))
+		shell_arrays()->del(array);
+	free(name);
+	return (done);
+}
+
+/**
+ * @brief Runs a command made of array assignments only.
+ * 
+ * Such a command is recognized on its raw words, before any expansion,
+ * as the elements of a list are expanded one by one.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param words The raw words of the command.
+ * 
+ * @return 1 if the command was array assignments, 0 otherwise.
+ */
+int	array_assign(t_tools *tools, char **words)
+{
+	int	status;
+	int	i;
+
+	i = 0;
+	while (words[i] && array_assign_name(words[i]))
+		i++;
+	if (!words[0] || words[i])
+		return (0);
+	status = EXIT_SUCCESS;
+	i = 0;
+	while (words[i])
+	{
+		if (!assign_word(tools, words[i++]))
+			status = EXIT_FAILURE;
+	}
+	global_status()->nbr = status;
+	return (1);
+}
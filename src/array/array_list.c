@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_list.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:24:08 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/array.h"
+
+/**
+ * @brief Finds an array by name.
+ * 
+ * @param name The name.
+ * 
+ * @return The array, or NULL if there is none.
+ */
+t_array	*array_find(char *name)
+{
+	return (hash_get(shell_arrays(), name));
+}
+
+/**
+ * @brief Counts the elements that are set in an array.
+ * 
+ * @param array The array.
+ * 
+ * @return The number of elements.
+ */
+int	array_length(t_array *array)
+{
+	int	length;
+	int	i;
+
+	if (array->assoc)
+		return (array->map.count);
+	length = 0;
+	i = 0;
+	while (i < array->count)
+		length += (array->items[i++] != NULL);
+	return (length);
+}
+
+/**
+ * @brief Lists the values or the keys of an associative array, in the
+ * byte order of the keys.
+ * 
+ * @param array The array.
+ * @param list The list to fill, long enough.
+ * @param keys 1 for the keys, 0 for the values.
+ * 
+ * @return 1 on success, 0 on allocation error.
+ */
+static int	values_assoc(t_array *array, char **list, int keys)
+{
+	char	**names;
+	int		i;
+
+	names = hash_keys(&array->map);
+	if (!names)
+		return (0);
+	i = 0;
+	while (names[i])
+	{
+		if (keys)
+			list[i] = ft_strdup(names[i]);
+		else
+			list[i] = ft_strdup(hash_get(&array->map, names[i]));
+		if (!list[i++])
+		{
+			free(names);
+			return (0);
+		}
+	}
+	free(names);
+	return (1);
+}
+
+/**
+ * @brief Lists the values or the indices of an indexed array, in the
+ * order of the indices.
+ * 
+ * @param array The array.
+ * @param list The list to fill, long enough.
+ * @param keys 1 for the indices, 0 for the values.
+ * 
+ * @return 1 on success, 0 on allocation error.
+ */
+static int	values_indexed(t_array *array, char **list, int keys)
+{
+	int	n;
+	int	i;
+
+	n = 0;
+	i = 0;
+	while (i < array->count)
+	{
+		if (array->items[i] && keys)
+			list[n] = ft_itoa(i);
+		else if (array->items[i])
+			list[n] = ft_strdup(array->items[i]);
+		if (array->items[i++] && !list[n++])
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief Lists the values or the keys of an array.
+ * 
+ * @param array The array.
+ * @param keys 1 for the keys or indices, 0 for the values.
+ * 
+ * @return A newly allocated NULL-terminated list of copies, or NULL on
+ * allocation error.
+ */
+char	**array_values(t_array *array, int keys)
+{
+	char	**list;
+	int		done;
+
+	list = ft_calloc(array_length(array) + 1, sizeof(char *));
+	if (!list)
+		return (NULL);
+	if (array->assoc)
+		done = values_assoc(array, list, keys);
+	else
+		done = values_indexed(array, list, keys);
+	if (!done)
+	{
+		free_list(list);
+		return (NULL);
+	}
+	return (list);
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:24:24 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/array.h"
+
+/**
+ * @brief Finds the end of a subscript.
+ * 
+ * Nested brackets are counted, and quotes and substitutions are skipped.
+ * 
+ * @param s The text.
+ * @param i Index of the opening bracket.
+ * 
+ * @return The index of the closing bracket, or -1 if it is missing.
+ */
+int	subscript_end(char *s, int i)
+{
+	int	depth;
+
+	depth = 0;
+	while (i >= 0 && s[i])
+	{
+		if (s[i] == '\'' || s[i] == '"')
+			i = quoted_end(s, i);
+		else
+		{
+			depth += (s[i] == '[') - (s[i] == ']');
+			if (!depth)
+				return (i);
+			i = word_skip(s, i);
+		}
+	}
+	return (-1);
+}
+
+/**
+ * @brief Tells whether a raw word is an array assignment.
+ * 
+ * That is "name=(...)", "name+=(...)" or "name[subscript]=value".
+ * 
+ * @param word The raw word.
+ * 
+ * @return The length of the name if it is, 0 otherwise.
+ */
+int	array_assign_name(char *word)
+{
+	int	len;
+	int	i;
+
+	if (!ft_isalpha(word[0]) && word[0] != '_')
+		return (0);
+	len = 0;
+	while (ft_isalnum(word[len]) || word[len] == '_')
+		len++;
+	if (word[len] == '[')
+	{
+		i = subscript_end(word, len);
+		if (i > len + 1 && word[i + 1] == '=')
+			return (len);
+		return (0);
+	}
+	i = len + (word[len] == '+');
+	if (word[i] == '=' && word[i + 1] == '('
+		&& subst_end(word, i) == (int)ft_strlen(word))
+		return (len);
+	return (0);
+}
+
+/**
+ * @brief Works out the index an indexed array subscript stands for.
+ * 
+ * The subscript is an arithmetic expression. A negative index counts
+ * back from the end of the array.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param array The array.
+ * @param sub The expanded subscript.
+ * @param index Where the index is stored.
+ * 
+ * @return 1 on success, 0 on error, which is printed.
+ */
+int	array_index(t_tools *tools, t_array *array, char *sub, long long *index)
+{
+	if (!arith_eval(tools, sub, 0, index))
+		return (0);
+	if (*index < 0)
+		*index += array->count;
+	if (*index >= 0)
+		return (1);
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(sub, STDERR_FILENO);
+	ft_putendl_fd(": bad array subscript", STDERR_FILENO);
+	return (0);
+}
+
+/**
+ * @brief Returns an element of an array.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param array The array.
+ * @param sub The expanded subscript, a key for an associative array.
+ * 
+ * @return The element, which still belongs to the array, or NULL if it
+ * is unset.
+ */
+char	*array_elem(t_tools *tools, t_array *array, char *sub)
+{
+	long long	index;
+
+	if (array->assoc)
+		return (hash_get(&array->map, sub));
+	if (!array_index(tools, array, sub, &index) || index >= array->count)
+		return (NULL);
+	return (array->items[index]);
+}
+
+/**
+ * @brief Returns the value of an array used as a plain variable.
+ * 
+ * That is its element 0, as in bash.
+ * 
+ * @param name The name of the array.
+ * 
+ * @return A newly allocated copy of the element, or NULL if there is no
+ * such array or element.
+ */
+char	*array_first(char *name)
+{
+	t_array	*array;
+	char	*value;
+
+	array = array_find(name);
+	if (!array)
+		return (NULL);
+	value = NULL;
+	if (array->assoc)
+		value = hash_get(&array->map, "0");
+	else if (array->count)
+		value = array->items[0];
+	if (!value)
+		return (NULL);
+	return (ft_strdup(value));
+}
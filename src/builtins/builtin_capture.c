@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_capture.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:03:03 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:07:34 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/builtins.h"
+
+/**
+ * @brief Appends bytes to a capture buffer.
+ * 
+ * The buffer doubles when full and is kept null-terminated. On allocation
+ * error the output captured so far is dropped.
+ * 
+ * @param capture The capture.
+ * @param str The bytes to append, or NULL.
+ * @param len Number of bytes.
+ */
+void	capture_write(t_capture *capture, char *str, size_t len)
+{
+	size_t	size;
+
+	if (!str || !len)
+		return ;
+	size = capture->size;
+	while (size < capture->len + len + 1)
+		size = size * 2 + FILE_CHUNK;
+	if (size != capture->size)
+	{
+		capture->data = ft_realloc(capture->data, size, capture->size);
+		capture->size = size;
+	}
+	if (!capture->data)
+	{
+		capture->len = 0;
+		capture->size = 0;
+		return ;
+	}
+	ft_memcpy(capture->data + capture->len, str, len);
+	capture->len += len;
+	capture->data[capture->len] = '\0';
+}
+
+/**
+ * @brief Starts capturing the output of builtins.
+ * 
+ * Pending output belongs to whatever ran before and is flushed first. A
+ * capture already running, from an outer substitution, is put aside until
+ * this one ends.
+ * 
+ * @param saved Where the outer capture is kept.
+ */
+void	capture_begin(t_capture *saved)
+{
+	t_output	*out;
+
+	output_flush(NULL, 0);
+	out = builtin_output();
+	*saved = out->capture;
+	out->capture = (t_capture){1, NULL, 0, 0};
+}
+
+/**
+ * @brief Stops capturing and gives back the outer capture, if any.
+ * 
+ * @param saved The outer capture, as saved by capture_begin().
+ * @param len Where the length of the output is stored.
+ * 
+ * @return The captured output, or NULL on allocation error.
+ */
+char	*capture_end(t_capture *saved, size_t *len)
+{
+	t_output	*out;
+	char		*data;
+
+	output_flush(NULL, 0);
+	out = builtin_output();
+	data = out->capture.data;
+	*len = out->capture.len;
+	out->capture = *saved;
+	if (!data)
+		data = ft_strdup("");
+	return (data);
+}
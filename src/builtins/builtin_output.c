@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_output.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:47:30 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:07:34 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/builtins.h"
+
+/**
+ * @brief Returns the output buffer shared by all builtins.
+ * 
+ * @return Pointer to the buffer. It lives for the whole run of the shell.
+ */
+t_output	*builtin_output(void)
+{
+	static t_output	output;
+
+	return (&output);
+}
+
+/**
+ * @brief Writes a list of buffers to stdout, resuming after short writes.
+ * 
+ * If the write fails for any other reason than a signal, the remaining
+ * output is dropped, just like a failed ft_putstr_fd() would have done.
+ * 
+ * @param iov The buffers to write.
+ * @param count The number of buffers.
+ */
+static void	write_iov(struct iovec *iov, int count)
+{
+	ssize_t	done;
+
+	while (count > 0)
+	{
+		done = writev(STDOUT_FILENO, iov, count);
+		if (done < 0 && errno == EINTR)
+			continue ;
+		if (done < 0)
+			return ;
+		while (count > 0 && (size_t)done >= iov->iov_len)
+		{
+			done -= iov->iov_len;
+			iov++;
+			count--;
+		}
+		if (count > 0)
+		{
+			iov->iov_base = (char *)iov->iov_base + done;
+			iov->iov_len -= done;
+		}
+	}
+}
+
+/**
+ * @brief Writes the buffered output, followed by an optional extra string.
+ * 
+ * The buffered bytes and the extra string leave in a single writev(), so a
+ * fragment too big for the buffer is never copied. While a command
+ * substitution captures the output, they go to its buffer instead.
+ * 
+ * @param str The extra string, or NULL.
+ * @param len Length of str.
+ */
+void	output_flush(char *str, size_t len)
+{
+	t_output		*out;
+	struct iovec	iov[2];
+	int				count;
+
+	out = builtin_output();
+	if (out->capture.on)
+	{
+		capture_write(&out->capture, out->data, out->len);
+		capture_write(&out->capture, str, len);
+		out->len = 0;
+		return ;
+	}
+	count = 0;
+	if (out->len)
+		iov[count++] = (struct iovec){out->data, out->len};
+	if (str && len)
+		iov[count++] = (struct iovec){str, len};
+	write_iov(iov, count);
+	out->len = 0;
+}
+
+/**
+ * @brief Appends bytes to the builtin output buffer.
+ * 
+ * Nothing is written until the buffer is full or the builtin returns, so a
+ * builtin printing thousands of lines costs a handful of system calls.
+ * 
+ * @param str The bytes to append.
+ * @param len Number of bytes.
+ */
+void	output_write(char *str, size_t len)
+{
+	t_output	*out;
+
+	out = builtin_output();
+	if (len > OUTPUT_BUFFER - out->len)
+	{
+		output_flush(str, len);
+		return ;
+	}
+	ft_memcpy(out->data + out->len, str, len);
+	out->len += len;
+}
+
+/**
+ * @brief Appends a string to the builtin output buffer.
+ * 
+ * @param str The string to append. NULL is ignored.
+ */
+void	output_str(char *str)
+{
+	if (str)
+		output_write(str, ft_strlen(str));
+}
@@ -6,12 +6,60 @@
 /*   By: crebelo- <crebelo-@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/19 20:20:19 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../includes/builtins.h"
 
+/**
+ * @brief Fills the entries of the builtins that define aliases, variables
+ * and arrays.
+ * 
+ * @param builtin_array The table to fill, BUILTINS entries long.
+ */
+static void	builtin_table_vars(t_builtin *builtin_array)
+{
+	builtin_array[22] = (t_builtin){"alias", cmd_alias};
+	builtin_array[23] = (t_builtin){"unalias", cmd_unalias};
+	builtin_array[24] = (t_builtin){"let", cmd_let};
+	builtin_array[25] = (t_builtin){"declare", cmd_declare};
+	builtin_array[26] = (t_builtin){"mapfile", cmd_mapfile};
+	builtin_array[27] = (t_builtin){"readarray", cmd_mapfile};
+}
+
+/**
+ * @brief Fills the table of builtin names and functions.
+ * 
+ * @param builtin_array The table to fill, BUILTINS entries long.
+ */
+static void	builtin_table(t_builtin *builtin_array)
+{
+	builtin_array[0] = (t_builtin){"echo", cmd_echo};
+	builtin_array[1] = (t_builtin){"cd", cmd_cd};
+	builtin_array[2] = (t_builtin){"pwd", cmd_pwd};
+	builtin_array[3] = (t_builtin){"export", cmd_export};
+	builtin_array[4] = (t_builtin){"unset", cmd_unset};
+	builtin_array[5] = (t_builtin){"env", cmd_env};
+	builtin_array[6] = (t_builtin){"exit", cmd_exit};
+	builtin_array[7] = (t_builtin){"history", cmd_history};
+	builtin_array[8] = (t_builtin){"parallel", cmd_parallel};
+	builtin_array[9] = (t_builtin){"exec", cmd_exec};
+	builtin_array[10] = (t_builtin){"source", cmd_source};
+	builtin_array[11] = (t_builtin){".", cmd_source};
+	builtin_array[12] = (t_builtin){"test", cmd_test};
+	builtin_array[13] = (t_builtin){"[", cmd_test};
+	builtin_array[14] = (t_builtin){"read", cmd_read};
+	builtin_array[15] = (t_builtin){"printf", cmd_printf};
+	builtin_array[16] = (t_builtin){"break", cmd_break};
+	builtin_array[17] = (t_builtin){"continue", cmd_continue};
+	builtin_array[18] = (t_builtin){":", cmd_true};
+	builtin_array[19] = (t_builtin){"true", cmd_true};
+	builtin_array[20] = (t_builtin){"false", cmd_true};
+	builtin_array[21] = (t_builtin){"return", cmd_return};
+	builtin_table_vars(builtin_array);
+}
+
 /**
  * @brief Determines if a command is a built-in function and 
  * returns its function pointer.
@@ -21,6 +69,8 @@
  * predefined built-in command names. If a match is found, 
  * it returns the function pointer
  * corresponding to that built-in command. Otherwise, it returns NULL.
+ * Shell functions are looked up first and run through cmd_function(), so
+ * a function shadows a builtin or a program of the same name.
  * 
  * @param str The command string to check.
  * 
@@ -30,18 +80,13 @@
 int	(*is_builtin(char *str))(t_tools *tools, t_parser *parser)
 {
 	size_t		i;
-	t_builtin	builtin_array[8];
+	t_builtin	builtin_array[BUILTINS];
 
-	builtin_array[0] = (t_builtin){"echo", cmd_echo};
-	builtin_array[1] = (t_builtin){"cd", cmd_cd};
-	builtin_array[2] = (t_builtin){"pwd", cmd_pwd};
-	builtin_array[3] = (t_builtin){"export", cmd_export};
-	builtin_array[4] = (t_builtin){"unset", cmd_unset};
-	builtin_array[5] = (t_builtin){"env", cmd_env};
-	builtin_array[6] = (t_builtin){"exit", cmd_exit};
-	builtin_array[7] = (t_builtin){"history", cmd_history};
+	if (hash_get(shell_functions(), str))
+		return (cmd_function);
+	builtin_table(builtin_array);
 	i = 0;
-	while (i < (sizeof(builtin_array) / sizeof(builtin_array[0])))
+	while (i < BUILTINS)
 	{
 		if (ft_strcmp(builtin_array[i].name, str) == 0)
 			return (builtin_array[i].builtin);
@@ -49,3 +94,55 @@ int	(*is_builtin(char *str))(t_tools *tools, t_parser *parser)
 	}
 	return (NULL);
 }
+
+/**
+ * @brief Runs a builtin with its prefix assignments.
+ * 
+ * The builtin, or shell function, sees the assigned variables in
+ * tools->env for as long as it runs; they get their old values back
+ * afterwards, in place, keeping any other change it made.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param parser The builtin command.
+ * 
+ * @return The exit status of the builtin.
+ */
+static int	run_prefixed(t_tools *tools, t_parser *parser)
+{
+	char	**saved;
+	int		status;
+
+	saved = tools->env;
+	tools->env = prefix_env(saved, parser->assigns);
+	if (!tools->env)
+	{
+		tools->env = saved;
+		return (parser->builtin(tools, parser));
+	}
+	status = parser->builtin(tools, parser);
+	prefix_restore(tools, saved, parser->assigns);
+	return (status);
+}
+
+/**
+ * @brief Runs a builtin and flushes whatever it printed.
+ * 
+ * Builtins print through the shared output buffer, so this is the single
+ * place where their stdout actually gets written.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param parser The builtin command.
+ * 
+ * @return The exit status of the builtin.
+ */
+int	run_builtin(t_tools *tools, t_parser *parser)
+{
+	int	status;
+
+	if (parser->assigns)
+		status = run_prefixed(tools, parser);
+	else
+		status = parser->builtin(tools, parser);
+	output_flush(NULL, 0);
+	return (status);
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_alias.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:36:33 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:38:11 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Prints an alias in a form that can be read back.
+ * 
+ * @param name The name of the alias.
+ * @param value Its value.
+ */
+static void	alias_print(char *name, char *value)
+{
+	char	*quote;
+
+	output_str("alias ");
+	output_str(name);
+	output_write("='", 2);
+	quote = ft_strchr(value, '\'');
+	while (quote)
+	{
+		output_write(value, quote - value);
+		output_write("'\\''", 4);
+		value = quote + 1;
+		quote = ft_strchr(value, '\'');
+	}
+	output_str(value);
+	output_write("'\n", 2);
+}
+
+/**
+ * @brief Prints every alias, sorted by name.
+ * 
+ * @return The exit status.
+ */
+static int	alias_list(void)
+{
+	char	**names;
+	int		i;
+
+	names = hash_keys(shell_aliases());
+	if (!names)
+		return (EXIT_FAILURE);
+	i = 0;
+	while (names[i])
+	{
+		alias_print(names[i], hash_get(shell_aliases(), names[i]));
+		i++;
+	}
+	free(names);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Defines an alias from a name=value argument.
+ * 
+ * @param arg The argument.
+ * @param eq Where the '=' is in the argument.
+ * 
+ * @return The exit status.
+ */
+static int	alias_define(char *arg, char *eq)
+{
+	char	*name;
+	char	*value;
+	int		i;
+
+	name = ft_substr(arg, 0, eq - arg);
+	value = ft_strdup(eq + 1);
+	i = 0;
+	while (name && name[i] && !ft_strchr(ALIAS_INVALID, name[i]))
+		i++;
+	if (name && value && i && !name[i]
+		&& hash_set(shell_aliases(), name, value))
+	{
+		free(name);
+		return (EXIT_SUCCESS);
+	}
+	free(value);
+	if (name && (!i || name[i]))
+		alias_err("alias", name, "invalid alias name");
+	else
+		alias_err("alias", arg, strerror(ENOMEM));
+	free(name);
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Executes the alias builtin.
+ * 
+ * Without arguments every alias is printed. A name=value argument defines
+ * an alias and a bare name prints it.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * 
+ * @return The exit status.
+ */
+int	cmd_alias(t_tools *tools, t_parser *command)
+{
+	char	*value;
+	char	*eq;
+	int		status;
+	int		i;
+
+	(void)tools;
+	status = EXIT_SUCCESS;
+	if (!command->str[1])
+		status = alias_list();
+	i = 1;
+	while (command->str[i])
+	{
+		eq = ft_strchr(command->str[i], '=');
+		value = hash_get(shell_aliases(), command->str[i]);
+		if (eq && alias_define(command->str[i], eq))
+			status = EXIT_FAILURE;
+		else if (!eq && value)
+			alias_print(command->str[i], value);
+		else if (!eq)
+			status = alias_err("alias", command->str[i], "not found");
+		i++;
+	}
+	global_status()->nbr = status;
+	return (status);
+}
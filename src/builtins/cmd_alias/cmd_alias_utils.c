@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_alias_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:36:45 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:38:11 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Returns the table of aliases.
+ * 
+ * Names map to their values. The table is hashed, so the parser looks up
+ * the first word of every command in constant time however many aliases
+ * there are.
+ * 
+ * @return Pointer to the table. It lives for the whole run of the shell.
+ */
+t_hash	*shell_aliases(void)
+{
+	static t_hash	aliases = {NULL, 0, 0, free};
+
+	return (&aliases);
+}
+
+/**
+ * @brief Prints an error of the alias or unalias builtin.
+ * 
+ * @param cmd The name of the builtin.
+ * @param arg The offending argument.
+ * @param msg The error message.
+ * 
+ * @return EXIT_FAILURE.
+ */
+int	alias_err(char *cmd, char *arg, char *msg)
+{
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(cmd, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putstr_fd(arg, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putendl_fd(msg, STDERR_FILENO);
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Executes the unalias builtin.
+ * 
+ * -a removes every alias.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * 
+ * @return The exit status.
+ */
+int	cmd_unalias(t_tools *tools, t_parser *command)
+{
+	int	status;
+	int	i;
+
+	(void)tools;
+	status = EXIT_SUCCESS;
+	if (!command->str[1])
+	{
+		ft_putendl_fd("unalias: usage: unalias [-a] name [name ...]",
+			STDERR_FILENO);
+		status = 2;
+	}
+	else if (ft_strcmp(command->str[1], "-a") == 0)
+		hash_clear(shell_aliases());
+	i = 1;
+	while (status != 2 && command->str[i] && ft_strcmp(command->str[1], "-a"))
+	{
+		if (!hash_del(shell_aliases(), command->str[i]))
+			status = alias_err("unalias", command->str[i], "not found");
+		i++;
+	}
+	global_status()->nbr = status;
+	return (status);
+}
@@ -6,7 +6,7 @@
 /*   By: ftomazc < ftomaz-c@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/26 12:41:36 by ftomazc          ###   ########.fr       */
+/*   Updated: 2026/10/18 23:48:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -90,8 +90,8 @@ int	cd_handle_slash_path(t_tools *tools)
 {
 	if (chdir(tools->oldpwd) == 0)
 	{
-		ft_putstr_fd(tools->oldpwd, STDOUT_FILENO);
-		ft_putstr_fd("\n", STDOUT_FILENO);
+		output_str(tools->oldpwd);
+		output_write("\n", 1);
 		free(tools->pwd);
 		tools->pwd = ft_strdup(tools->oldpwd);
 		free(tools->oldpwd);
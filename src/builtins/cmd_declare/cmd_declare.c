@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_declare.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:32:22 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Reads the options of the declare builtin.
+ * 
+ * @param args The arguments.
+ * @param kind Where 'a' or 'A' is stored, for -a or -A.
+ * @param print Where 1 is stored, for -p.
+ * 
+ * @return The index of the first name, or -1 on an invalid option.
+ */
+static int	declare_options(char **args, int *kind, int *print)
+{
+	int	i;
+	int	j;
+
+	i = 1;
+	while (args[i] && args[i][0] == '-' && args[i][1])
+	{
+		if (!ft_strcmp(args[i], "--"))
+			return (i + 1);
+		j = 1;
+		while (args[i][j] == 'a' || args[i][j] == 'A' || args[i][j] == 'p')
+		{
+			if (args[i][j] == 'p')
+				*print = 1;
+			else
+				*kind = args[i][j];
+			j++;
+		}
+		if (args[i][j])
+			return (-1 - alias_err("declare", args[i], "invalid option"));
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Declares or prints one name.
+ * 
+ * An array is created with the kind asked for, and an existing one must
+ * already be of that kind, as an array cannot be converted.
+ * 
+ * @param name The name.
+ * @param kind 'a' or 'A' for -a or -A, else 0.
+ * @param print 1 for -p, else 0.
+ * 
+ * @return The exit status.
+ */
+static int	declare_name(char *name, int kind, int print)
+{
+	t_array	*array;
+
+	if (!is_valid_name(name))
+		return (alias_err("declare", name, "not a valid identifier"));
+	array = array_find(name);
+	if (print && array)
+		return (declare_print(name, array));
+	if (print)
+		return (alias_err("declare", name, "not found"));
+	if (!array && kind && !array_new(name, kind == 'A'))
+		return (alias_err("declare", name, strerror(ENOMEM)));
+	if (array && kind == 'A' && !array->assoc)
+		return (alias_err("declare", name,
+				"cannot convert indexed to associative array"));
+	if (array && kind == 'a' && array->assoc)
+		return (alias_err("declare", name,
+				"cannot convert associative to indexed array"));
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Executes the declare builtin.
+ * 
+ * Only arrays are known to it: "declare -a name" and "declare -A name"
+ * make an indexed and an associative array, and -p prints arrays back
+ * as declare commands. Without names, every array is printed.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * 
+ * @return The exit status.
+ */
+int	cmd_declare(t_tools *tools, t_parser *command)
+{
+	int	status;
+	int	print;
+	int	kind;
+	int	i;
+
+	(void)tools;
+	print = 0;
+	kind = 0;
+	i = declare_options(command->str, &kind, &print);
+	status = EXIT_SUCCESS;
+	if (i < 0)
+	{
+		ft_putendl_fd("declare: usage: declare [-aAp] [name ...]",
+			STDERR_FILENO);
+		status = 2;
+	}
+	else if (!command->str[i])
+		status = declare_list();
+	while (i > 0 && command->str[i])
+	{
+		if (declare_name(command->str[i++], kind, print))
+			status = EXIT_FAILURE;
+	}
+	global_status()->nbr = status;
+	return (status);
+}
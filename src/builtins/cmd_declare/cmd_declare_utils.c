@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_declare_utils.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:32:22 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Prints a key or a value of an array in a form that can be read
+ * back.
+ * 
+ * @param s The key or value.
+ * @param bare 1 to leave it unquoted when it is a plain word, 0 to always
+ * quote it.
+ */
+static void	declare_quoted(char *s, int bare)
+{
+	size_t	i;
+
+	i = 0;
+	while (bare && (ft_isalnum(s[i]) || s[i] == '_'))
+		i++;
+	if (bare && i && !s[i])
+	{
+		output_str(s);
+		return ;
+	}
+	output_write("\"", 1);
+	while (*s)
+	{
+		if (ft_strchr("\"\\$`", *s))
+			output_write("\\", 1);
+		output_write(s++, 1);
+	}
+	output_write("\"", 1);
+}
+
+/**
+ * @brief Prints the elements of an array as a "(...)" list.
+ * 
+ * @param array The array.
+ * @param keys Its keys or indices.
+ * @param values Its values, in the same order.
+ */
+static void	declare_elems(t_array *array, char **keys, char **values)
+{
+	int	i;
+
+	output_write("=(", 2);
+	i = 0;
+	while (keys[i] && values[i])
+	{
+		if (i > 0 && !array->assoc)
+			output_write(" ", 1);
+		output_write("[", 1);
+		declare_quoted(keys[i], 1);
+		output_write("]=", 2);
+		declare_quoted(values[i++], 0);
+		if (array->assoc)
+			output_write(" ", 1);
+	}
+	output_write(")\n", 2);
+}
+
+/**
+ * @brief Prints an array as the declare command that would make it.
+ * 
+ * @param name The name of the array.
+ * @param array The array.
+ * 
+ * @return The exit status.
+ */
+int	declare_print(char *name, t_array *array)
+{
+	char	**keys;
+	char	**values;
+	int		status;
+
+	keys = array_values(array, 1);
+	values = array_values(array, 0);
+	status = EXIT_FAILURE;
+	if (keys && values)
+	{
+		if (array->assoc)
+			output_str("declare -A ");
+		else
+			output_str("declare -a ");
+		output_str(name);
+		declare_elems(array, keys, values);
+		status = EXIT_SUCCESS;
+	}
+	if (keys)
+		free_list(keys);
+	if (values)
+		free_list(values);
+	return (status);
+}
+
+/**
+ * @brief Prints every array, sorted by name.
+ * 
+ * @return The exit status.
+ */
+int	declare_list(void)
+{
+	char	**names;
+	int		status;
+	int		i;
+
+	names = hash_keys(shell_arrays());
+	if (!names)
+		return (EXIT_FAILURE);
+	status = EXIT_SUCCESS;
+	i = 0;
+	while (names[i])
+	{
+		if (declare_print(names[i], array_find(names[i])))
+			status = EXIT_FAILURE;
+		i++;
+	}
+	free(names);
+	return (status);
+}
@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 16:17:01 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/18 23:48:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -61,13 +61,13 @@ void	echo_print(t_parser *command, int pos, int flag)
 {
 	while (command->str[pos])
 	{
-		ft_putstr_fd(command->str[pos], STDOUT_FILENO);
+		output_str(command->str[pos]);
 		if (command->str[pos + 1])
-			ft_putstr_fd(" ", STDOUT_FILENO);
+			output_write(" ", 1);
 		pos++;
 	}
 	if (!flag)
-		ft_putstr_fd("\n", STDOUT_FILENO);
+		output_write("\n", 1);
 }
 
 /**
@@ -92,7 +92,7 @@ int	cmd_echo(t_tools *tools, t_parser *command)
 	(void)tools;
 	cmd = command;
 	if (!cmd->str[i])
-		ft_putstr_fd("\n", STDOUT_FILENO);
+		output_write("\n", 1);
 	else
 	{
 		flag = echo_n_flag(cmd->str, &i);
@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 18:53:02 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/18 23:48:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -109,8 +109,8 @@ int	cmd_env(t_tools *tools, t_parser *command)
 		{
 			if (!tmp->env[i])
 				break ;
-			ft_putstr_fd(tmp->env[i], STDOUT_FILENO);
-			ft_putstr_fd("\n", STDOUT_FILENO);
+			output_str(tmp->env[i]);
+			output_write("\n", 1);
 			i++;
 		}
 	}
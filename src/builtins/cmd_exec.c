@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_exec.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:53:35 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:03:43 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/builtins.h"
+
+/**
+ * @brief Records which descriptors an "exec" without command left open.
+ * 
+ * Those descriptors belong to the script from now on, so the shell must
+ * not close them after running a command. Redirections of stdin and stdout
+ * also become the ones the shell goes back to after each command.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param parser The exec command.
+ */
+static void	exec_keep_fds(t_tools *tools, t_parser *parser)
+{
+	t_lexer	*current;
+	int		fd;
+
+	current = parser->redirections;
+	while (current)
+	{
+		fd = set_fd(current, parser);
+		while (current && !current->words)
+			current = current->next;
+		if (fd >= 0 && fd < MAX_FDS)
+			tools->exec_fds[fd] = (fcntl(fd, F_GETFD) != -1);
+		if (fd == STDIN_FILENO)
+			dup2(STDIN_FILENO, tools->original_stdin);
+		else if (fd == STDOUT_FILENO)
+			dup2(STDOUT_FILENO, tools->original_stdout);
+		if (current)
+			current = current->next;
+	}
+}
+
+/**
+ * @brief Replaces the shell with the given command.
+ * 
+ * Like in bash, only external commands can be exec'ed. If execve() fails
+ * the error is reported and a script exits, while an interactive shell
+ * carries on.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param parser The exec command.
+ */
+static void	exec_command(t_tools *tools, t_parser *parser)
+{
+	char	**argv;
+
+	argv = list_dup(parser->str, 1, count_lines(parser->str));
+	if (!argv)
+		return ;
+	free_list(parser->str);
+	parser->str = argv;
+	output_flush(NULL, 0);
+	read_sync();
+	if (is_executable(tools, argv, tools->env))
+		exec_path(tools, argv, tools->env);
+	if (tools->nint_mode)
+		free_and_exit(tools, global_status()->nbr);
+}
+
+/**
+ * @brief Executes the exec builtin.
+ * 
+ * With a command, the shell is replaced by it without forking. Without
+ * one, the redirections of the command line have already been applied to
+ * the shell itself and are kept, so "exec 3>log" opens the file once for
+ * the rest of the script and "exec 3>&-" closes it.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command Pointer to the parsed exec command.
+ * 
+ * @return The exit status of the command.
+ */
+int	cmd_exec(t_tools *tools, t_parser *command)
+{
+	global_status()->nbr = EXIT_SUCCESS;
+	if (command->str[1])
+		exec_command(tools, command);
+	else
+		exec_keep_fds(tools, command);
+	return (global_status()->nbr);
+}
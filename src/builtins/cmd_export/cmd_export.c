@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 18:56:12 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/18 23:48:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -37,8 +37,8 @@ void	sort_print_env(t_tools *tools)
 			i++;
 		else
 		{
-			ft_putstr_fd(env_copy[i++], STDOUT_FILENO);
-			ft_putstr_fd("\n", STDOUT_FILENO);
+			output_str(env_copy[i++]);
+			output_write("\n", 1);
 		}
 	}
 	free_list(env_copy);
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_function.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:32:48 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:34:42 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Prints an error of a function call and sets the exit status.
+ * 
+ * @param name The name of the function.
+ * @param msg The error message.
+ * @param status The exit status.
+ * 
+ * @return The exit status.
+ */
+static int	func_err(char *name, char *msg, int status)
+{
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(name, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putendl_fd(msg, STDERR_FILENO);
+	global_status()->nbr = status;
+	return (status);
+}
+
+/**
+ * @brief Sets the shell up for the body of a function.
+ * 
+ * The arguments of the call become the positional parameters; $0 is left
+ * alone. The current stdin and stdout become the ones the commands of the
+ * body go back to, so "f > out" and "f | cat" get all of its output.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The call.
+ * @param saved Where the state of the caller is saved.
+ */
+static void	func_enter(t_tools *tools, t_parser *command, t_call *saved)
+{
+	char	**argv;
+
+	*saved = (t_call){tools->parser, shell_params()->argv, tools->pipes,
+		tools->loop_depth, {tools->original_stdin, tools->original_stdout}};
+	tools->parser = NULL;
+	tools->loop_depth = 0;
+	tools->func_depth++;
+	std_rebase(tools);
+	argv = list_dup(command->str, 0, count_lines(command->str));
+	if (!argv || !saved->argv)
+	{
+		if (argv)
+			free_list(argv);
+		return ;
+	}
+	free(argv[0]);
+	argv[0] = ft_strdup(saved->argv[0]);
+	shell_params()->argv = argv;
+}
+
+/**
+ * @brief Goes back to the state saved by func_enter().
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param saved The saved state.
+ */
+static void	func_leave(t_tools *tools, t_call *saved)
+{
+	if (shell_params()->argv != saved->argv)
+		free_list(shell_params()->argv);
+	shell_params()->argv = saved->argv;
+	if (tools->original_stdin >= 0)
+		close(tools->original_stdin);
+	if (tools->original_stdout >= 0)
+		close(tools->original_stdout);
+	tools->original_stdin = saved->std[0];
+	tools->original_stdout = saved->std[1];
+	tools->parser = saved->parser;
+	tools->pipes = saved->pipes;
+	tools->loop_depth = saved->loop_depth;
+	tools->func_depth--;
+	tools->returns = 0;
+}
+
+/**
+ * @brief Calls a shell function.
+ * 
+ * The body was parsed once, when the function was defined, and runs in
+ * the shell process like any other compound command. It is held for the
+ * duration of the call, so a body that redefines its own function does
+ * not pull the ground from under itself.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The call.
+ * 
+ * @return The exit status of the last command of the body, or the one
+ * given to return.
+ */
+int	cmd_function(t_tools *tools, t_parser *command)
+{
+	t_call	saved;
+	t_node	*body;
+
+	body = hash_get(shell_functions(), command->str[0]);
+	if (!body)
+		return (func_err(command->str[0], "command not found", 127));
+	if (tools->func_depth >= MAX_FUNC_DEPTH)
+		return (func_err(command->str[0],
+				"maximum function nesting level exceeded", 1));
+	body->refs++;
+	func_enter(tools, command, &saved);
+	global_status()->nbr = EXIT_SUCCESS;
+	exec_node(tools, body);
+	func_leave(tools, &saved);
+	node_free(body);
+	return (global_status()->nbr);
+}
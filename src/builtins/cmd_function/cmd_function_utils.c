@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_function_utils.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:32:48 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:34:42 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Drops the function table's hold on a body.
+ * 
+ * @param body The body.
+ */
+static void	func_free(void *body)
+{
+	node_free(body);
+}
+
+/**
+ * @brief Returns the table of shell functions.
+ * 
+ * Names map to the parsed bodies, so a call neither reads nor lexes the
+ * definition again.
+ * 
+ * @return Pointer to the table. It lives for the whole run of the shell.
+ */
+t_hash	*shell_functions(void)
+{
+	static t_hash	functions = {NULL, 0, 0, func_free};
+
+	return (&functions);
+}
+
+/**
+ * @brief Runs a function definition.
+ * 
+ * The body stays part of the command line it was parsed from; the table
+ * only takes a reference to it, so a definition run again by a loop costs
+ * no copy.
+ * 
+ * @param node The definition.
+ */
+void	func_define(t_node *node)
+{
+	global_status()->nbr = EXIT_SUCCESS;
+	if (!node->list)
+		return ;
+	node->list->refs++;
+	if (hash_set(shell_functions(), node->text, node->list))
+		return ;
+	node->list->refs--;
+	ft_putendl_fd("minishell: function: cannot allocate memory",
+		STDERR_FILENO);
+	global_status()->nbr = EXIT_FAILURE;
+}
+
+/**
+ * @brief Prints an error of the return builtin and sets the exit status.
+ * 
+ * @param arg The offending argument, or NULL.
+ * @param msg The error message.
+ * @param status The exit status.
+ * 
+ * @return The exit status.
+ */
+static int	return_err(char *arg, char *msg, int status)
+{
+	ft_putstr_fd("minishell: return: ", STDERR_FILENO);
+	if (arg)
+	{
+		ft_putstr_fd(arg, STDERR_FILENO);
+		ft_putstr_fd(": ", STDERR_FILENO);
+	}
+	ft_putendl_fd(msg, STDERR_FILENO);
+	global_status()->nbr = status;
+	return (status);
+}
+
+/**
+ * @brief Executes the return builtin.
+ * 
+ * The commands left in the function or sourced file see tools->returns
+ * and are skipped. Without an argument, the status of the last command is
+ * kept.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * 
+ * @return The exit status.
+ */
+int	cmd_return(t_tools *tools, t_parser *command)
+{
+	char	*arg;
+
+	arg = command->str[1];
+	if (!tools->func_depth && !tools->sourcing)
+		return (return_err(NULL,
+				"can only `return' from a function or sourced script", 2));
+	if (arg && check_exit_args(command) != 1)
+	{
+		tools->returns = 1;
+		return (return_err(arg, "numeric argument required", 2));
+	}
+	if (arg && command->str[2])
+		return (return_err(NULL, "too many arguments", 1));
+	if (arg)
+		global_status()->nbr = (unsigned char)ft_atoll(arg);
+	tools->returns = 1;
+	return (global_status()->nbr);
+}
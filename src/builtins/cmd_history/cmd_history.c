@@ -6,7 +6,7 @@
 /*   By: ftomaz-c <ftomaz-c@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/24 17:28:06 by ftomaz-c         ###   ########.fr       */
+/*   Updated: 2026/10/18 23:48:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -55,15 +55,15 @@ int	invalid_history_options(t_tools *tools, t_parser *command)
 		if (!check_exit_args(command))
 		{
 			global_status()->nbr = EXIT_FAILURE;
-			ft_putstr_fd("minishell: history: ", STDOUT_FILENO);
-			ft_putstr_fd(command->str[1], STDOUT_FILENO);
-			ft_putstr_fd(": numeric argument required\n", STDOUT_FILENO);
+			ft_putstr_fd("minishell: history: ", STDERR_FILENO);
+			ft_putstr_fd(command->str[1], STDERR_FILENO);
+			ft_putstr_fd(": numeric argument required\n", STDERR_FILENO);
 			return (global_status()->nbr);
 		}
 	}
 	if (command->str[2] != NULL)
 	{
-		ft_putstr_fd("minishell: history: too many arguments\n", STDOUT_FILENO);
+		ft_putstr_fd("minishell: history: too many arguments\n", STDERR_FILENO);
 		global_status()->nbr = EXIT_FAILURE;
 		return (global_status()->nbr);
 	}
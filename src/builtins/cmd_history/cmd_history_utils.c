@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/23 18:06:00 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/18 23:48:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -116,9 +116,9 @@ void	print_buffer(char **str)
 	i = 0;
 	while (str[i])
 	{
-		ft_putstr_fd(str[i], STDERR_FILENO);
+		output_str(str[i]);
 		i++;
 		if (!str[i])
-			ft_putstr_fd("\n", STDOUT_FILENO);
+			output_write("\n", 1);
 	}
 }
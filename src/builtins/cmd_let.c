@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_let.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:59:01 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:00:51 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Executes the let builtin.
+ * 
+ * Each argument is an arithmetic expression, evaluated in order. As let
+ * is mostly found in loops, and its arguments seldom change, their parse
+ * trees are cached.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * 
+ * @return 0 if the last expression is not 0, 1 otherwise.
+ */
+int	cmd_let(t_tools *tools, t_parser *command)
+{
+	long long	value;
+	int			status;
+	int			i;
+
+	status = 1;
+	value = 0;
+	i = 1;
+	if (!command->str[1])
+		ft_putendl_fd("minishell: let: expression expected", STDERR_FILENO);
+	while (command->str[i] && arith_eval(tools, command->str[i], 1, &value))
+		i++;
+	if (i > 1 && !command->str[i])
+		status = (value == 0);
+	global_status()->nbr = status;
+	return (status);
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_loop.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:22:44 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:28:44 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Prints an error of the break or continue builtin.
+ * 
+ * @param command The builtin command.
+ * @param msg The error message.
+ * @param status The exit status.
+ * 
+ * @return The exit status.
+ */
+static int	loop_err(t_parser *command, char *msg, int status)
+{
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	ft_putstr_fd(command->str[0], STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	if (status)
+	{
+		ft_putstr_fd(command->str[1], STDERR_FILENO);
+		ft_putstr_fd(": ", STDERR_FILENO);
+	}
+	ft_putendl_fd(msg, STDERR_FILENO);
+	return (status);
+}
+
+/**
+ * @brief Reads the number of loops a break or continue applies to.
+ * 
+ * A count larger than the number of enclosing loops applies to all of
+ * them.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * @param level Where the count is stored, 0 on error.
+ * 
+ * @return The exit status.
+ */
+static int	loop_level(t_tools *tools, t_parser *command, int *level)
+{
+	char	*arg;
+	long	n;
+	int		i;
+
+	*level = 0;
+	arg = command->str[1];
+	if (!tools->loop_depth)
+		return (loop_err(command,
+				"only meaningful in a `for', `while', or `until' loop", 0));
+	n = !arg;
+	i = 0;
+	while (arg && ft_isdigit(arg[i]))
+	{
+		if (n < INT_MAX)
+			n = n * 10 + (arg[i] - '0');
+		i++;
+	}
+	if (arg && (!i || arg[i]))
+		return (loop_err(command, "numeric argument required", 1));
+	if (n < 1)
+		return (loop_err(command, "loop count out of range", 1));
+	*level = tools->loop_depth;
+	if (n < tools->loop_depth)
+		*level = n;
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Executes the break builtin.
+ * 
+ * The loops being left see tools->breaks once the current command is
+ * done and stop one by one.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * 
+ * @return The exit status.
+ */
+int	cmd_break(t_tools *tools, t_parser *command)
+{
+	int	status;
+	int	level;
+
+	status = loop_level(tools, command, &level);
+	tools->breaks = level;
+	global_status()->nbr = status;
+	return (status);
+}
+
+/**
+ * @brief Executes the continue builtin.
+ * 
+ * The loops being left see tools->continues once the current command is
+ * done; the last one goes on with its next pass.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * 
+ * @return The exit status.
+ */
+int	cmd_continue(t_tools *tools, t_parser *command)
+{
+	int	status;
+	int	level;
+
+	status = loop_level(tools, command, &level);
+	tools->continues = level;
+	global_status()->nbr = status;
+	return (status);
+}
+
+/**
+ * @brief Executes the true, false and : builtins.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * 
+ * @return 1 for false, 0 otherwise.
+ */
+int	cmd_true(t_tools *tools, t_parser *command)
+{
+	(void)tools;
+	global_status()->nbr = (ft_strcmp(command->str[0], "false") == 0);
+	return (global_status()->nbr);
+}
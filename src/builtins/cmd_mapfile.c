@@ -0,0 +1,184 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_mapfile.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:32:43 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/builtins.h"
+
+/**
+ * @brief Reads the options of the mapfile builtin.
+ * 
+ * @param args The arguments.
+ * @param trim Where 1 is stored, for -t.
+ * 
+ * @return The index of the name, or -1 on an invalid option.
+ */
+static int	mapfile_options(char **args, int *trim)
+{
+	int	i;
+
+	i = 1;
+	while (args[i] && args[i][0] == '-' && args[i][1])
+	{
+		if (!ft_strcmp(args[i], "--"))
+			return (i + 1);
+		if (ft_strcmp(args[i], "-t"))
+		{
+			alias_err(args[0], args[i], "invalid option");
+			ft_putstr_fd(args[0], STDERR_FILENO);
+			ft_putendl_fd(": usage: mapfile [-t] [array]", STDERR_FILENO);
+			return (-1);
+		}
+		*trim = 1;
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Counts the lines of a text, the last one with or without its
+ * newline.
+ * 
+ * @param text The text.
+ * @param len Its length.
+ * 
+ * @return The number of lines.
+ */
+static int	mapfile_count(char *text, size_t len)
+{
+	char	*end;
+	int		lines;
+
+	lines = 0;
+	end = text + len;
+	while (text < end)
+	{
+		text = ft_memchr(text, '\n', end - text);
+		if (!text)
+			text = end;
+		else
+			text++;
+		lines++;
+	}
+	return (lines);
+}
+
+/**
+ * @brief Splits a text into the elements of an array, one per line.
+ * 
+ * The element table is allocated once for every line, so that it never
+ * has to grow, and each line is then copied with one allocation of its
+ * own, sized from where its newline was found.
+ * 
+ * @param array The new empty array.
+ * @param text The text.
+ * @param len Its length.
+ * @param trim 1 to drop the newline of each line, 0 to keep it.
+ * 
+ * @return 1 on success, 0 on allocation error.
+ */
+static int	mapfile_fill(t_array *array, char *text, size_t len, int trim)
+{
+	char	*end;
+	char	*next;
+	char	*line;
+	size_t	n;
+
+	array->size = mapfile_count(text, len);
+	array->items = ft_calloc(array->size + 1, sizeof(char *));
+	if (!array->items)
+		return (0);
+	end = text + len;
+	while (text < end)
+	{
+		next = ft_memchr(text, '\n', end - text);
+		if (!next)
+			next = end - 1;
+		next++;
+		n = next - text - (trim && next[-1] == '\n');
+		line = ft_calloc(n + 1, 1);
+		if (line)
+			ft_memcpy(line, text, n);
+		if (!array_put(array, array->count, line))
+			return (0);
+		text = next;
+	}
+	return (1);
+}
+
+/**
+ * @brief Reads the standard input into an array, one element per line.
+ * 
+ * The array is built aside, and replaces the one by that name only once
+ * it is complete.
+ * 
+ * @param name The name of the array.
+ * @param trim 1 to drop the newline of each line, 0 to keep it.
+ * 
+ * @return The exit status.
+ */
+static int	mapfile_read(char *name, int trim)
+{
+	t_array	*array;
+	char	*text;
+	size_t	len;
+	int		done;
+
+	read_sync();
+	text = read_fd(STDIN_FILENO, &len);
+	array = array_new(NULL, 0);
+	done = (text && array && mapfile_fill(array, text, len, trim)
+			&& hash_set(shell_arrays(), name, array));
+	if (!done && array)
+		shell_arrays()->del(array);
+	free(text);
+	if (!done)
+		return (alias_err("mapfile", name, strerror(errno)));
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Executes the mapfile and readarray builtins.
+ * 
+ * The standard input is read to its end with large reads, and each of its
+ * lines becomes an element of the indexed array named, MAPFILE by
+ * default.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The builtin command.
+ * 
+ * @return The exit status.
+ */
+int	cmd_mapfile(t_tools *tools, t_parser *command)
+{
+	t_array	*array;
+	char	*name;
+	int		status;
+	int		trim;
+	int		i;
+
+	(void)tools;
+	trim = 0;
+	i = mapfile_options(command->str, &trim);
+	name = "MAPFILE";
+	if (i > 0 && command->str[i])
+		name = command->str[i];
+	array = array_find(name);
+	if (i < 0)
+		status = 2;
+	else if (!is_valid_name(name))
+		status = alias_err(command->str[0], name, "not a valid identifier");
+	else if (array && array->assoc)
+		status = alias_err(command->str[0], name, "not an indexed array");
+	else
+		status = mapfile_read(name, trim);
+	global_status()->nbr = status;
+	return (status);
+}
@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_parallel.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:30:03 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:03:43 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Prints a parallel usage error and sets the exit status.
+ * 
+ * @param str The offending argument. Can be NULL.
+ * @param msg The message printed after the argument.
+ * 
+ * @return Always 0, so callers can return it directly.
+ */
+int	parallel_err(char *str, char *msg)
+{
+	ft_putstr_fd("minishell: parallel: ", STDERR_FILENO);
+	if (str)
+		ft_putstr_fd(str, STDERR_FILENO);
+	ft_putstr_fd(msg, STDERR_FILENO);
+	global_status()->nbr = 2;
+	return (0);
+}
+
+/**
+ * @brief Parses the options of the parallel command.
+ * 
+ * The number of job slots defaults to the number of online CPUs and can be
+ * changed with "-j N" or "-jN". Option parsing stops at the first word that
+ * is not an option, at "--" or at ":::".
+ * 
+ * @param par The parallel structure being filled.
+ * @param str The command arguments.
+ * @param i Pointer to the index of the current argument.
+ * 
+ * @return 1 on success, 0 on a usage error.
+ */
+int	parallel_options(t_parallel *par, char **str, int *i)
+{
+	par->jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	if (par->jobs < 1)
+		par->jobs = 1;
+	while (str[*i] && str[*i][0] == '-' && ft_strcmp(str[*i], ":::") != 0)
+	{
+		if (ft_strcmp(str[*i], "--") == 0)
+		{
+			(*i)++;
+			break ;
+		}
+		if (ft_strcmp(str[*i], "-j") == 0 && str[*i + 1])
+			par->jobs = ft_atoi(str[++(*i)]);
+		else if (ft_strncmp(str[*i], "-j", 2) == 0 && str[*i][2])
+			par->jobs = ft_atoi(str[*i] + 2);
+		else
+			return (parallel_err(str[*i], ": invalid option\n"));
+		(*i)++;
+	}
+	if (par->jobs < 1)
+		return (parallel_err(NULL, "invalid number of job slots\n"));
+	return (1);
+}
+
+/**
+ * @brief Splits the remaining words into the command and its arguments.
+ * 
+ * Everything before ":::" is the command template. The words after it are
+ * the job arguments. Without ":::", the arguments are read from stdin, one
+ * per line, with a single large read loop.
+ * 
+ * @param par The parallel structure being filled.
+ * @param str The command words, starting after the options.
+ * 
+ * @return 1 on success, 0 on a usage or allocation error.
+ */
+int	parallel_args(t_parallel *par, char **str)
+{
+	int		sep;
+	char	*data;
+
+	sep = 0;
+	while (str[sep] && ft_strcmp(str[sep], ":::") != 0)
+		sep++;
+	if (sep == 0)
+		return (parallel_err(NULL, "missing command\n"));
+	par->cmd = list_dup(str, 0, sep);
+	if (str[sep])
+		par->args = list_dup(str, sep + 1, count_lines(str));
+	else
+	{
+		data = read_fd(STDIN_FILENO, NULL);
+		if (data)
+			par->args = ft_split(data, "\n");
+		free(data);
+	}
+	if (!par->cmd || !par->args)
+		return (parallel_err(NULL, "cannot allocate memory\n"));
+	par->nargs = count_lines(par->args);
+	return (1);
+}
+
+/**
+ * @brief Frees the memory owned by a parallel structure.
+ * 
+ * @param par The parallel structure to free.
+ */
+void	parallel_free(t_parallel *par)
+{
+	if (par->cmd)
+		free_list(par->cmd);
+	if (par->args)
+		free_list(par->args);
+	if (par->slots)
+		free(par->slots);
+}
+
+/**
+ * @brief Runs a command once per argument on a bounded pool of children.
+ * 
+ * Usage: parallel [-j N] CMD [WORDS...] [::: ARG...]
+ * 
+ * Each job runs CMD with its argument substituted for every "{}" in the
+ * command words, or appended when there is no "{}". At most N children are
+ * in flight; a slot is refilled as soon as one exits. The output of every job
+ * is buffered in an anonymous file and written out in one piece when the job
+ * ends, followed by its exit status on stderr.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command Pointer to the parsed parallel command.
+ * 
+ * @return The number of failed jobs (at most 101), 130 if interrupted, or 2
+ * on a usage error.
+ */
+int	cmd_parallel(t_tools *tools, t_parser *command)
+{
+	t_parallel	par;
+	int			i;
+
+	ft_memset(&par, 0, sizeof(t_parallel));
+	read_sync();
+	i = 1;
+	if (parallel_options(&par, command->str, &i)
+		&& parallel_args(&par, command->str + i))
+	{
+		if (par.jobs > par.nargs)
+			par.jobs = par.nargs;
+		if (par.nargs)
+			par.slots = ft_calloc(par.jobs, sizeof(t_job));
+		if (par.slots)
+			parallel_run(tools, &par);
+		global_status()->nbr = par.failed;
+		if (par.failed > 101)
+			global_status()->nbr = 101;
+		if (par.stop)
+			global_status()->nbr = 130;
+	}
+	parallel_free(&par);
+	return (global_status()->nbr);
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_parallel_utils1.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:30:03 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/18 23:42:14 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Replaces every "{}" in a word with the job argument.
+ * 
+ * @param word The command word containing one or more "{}".
+ * @param arg The job argument.
+ * 
+ * @return A newly allocated word with the replacements done.
+ */
+char	*replace_braces(char *word, char *arg)
+{
+	char	*result;
+	char	*pos;
+
+	result = ft_strdup("");
+	pos = ft_strnstr(word, "{}", ft_strlen(word));
+	while (result && pos)
+	{
+		result = append_len(result, word, pos - word);
+		result = append_len(result, arg, ft_strlen(arg));
+		word = pos + 2;
+		pos = ft_strnstr(word, "{}", ft_strlen(word));
+	}
+	if (result)
+		result = append_len(result, word, ft_strlen(word));
+	return (result);
+}
+
+/**
+ * @brief Builds the argument vector of a single job.
+ * 
+ * The job argument replaces every "{}" in the command words. If no word
+ * contains "{}", it is appended as the last argument instead.
+ * 
+ * @param cmd The command template.
+ * @param arg The job argument.
+ * 
+ * @return A newly allocated, null-terminated argument vector.
+ */
+char	**parallel_argv(char **cmd, char *arg)
+{
+	char	**argv;
+	int		replaced;
+	int		i;
+
+	argv = ft_calloc(count_lines(cmd) + 2, sizeof(char *));
+	if (!argv)
+		return (NULL);
+	replaced = 0;
+	i = -1;
+	while (cmd[++i])
+	{
+		if (ft_strnstr(cmd[i], "{}", ft_strlen(cmd[i])))
+		{
+			argv[i] = replace_braces(cmd[i], arg);
+			replaced = 1;
+		}
+		else
+			argv[i] = ft_strdup(cmd[i]);
+	}
+	if (!replaced)
+		argv[i] = ft_strdup(arg);
+	return (argv);
+}
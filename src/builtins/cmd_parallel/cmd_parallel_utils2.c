@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_parallel_utils2.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:30:03 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:51:52 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Runs a single job inside the freshly forked child.
+ * 
+ * Stdout and stderr are pointed at the job's anonymous files so the parent
+ * can print the output of each job in one block. The command is resolved
+ * through exec_path() like any other external command.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param par The parallel structure.
+ * @param job The job being started.
+ */
+void	parallel_child(t_tools *tools, t_parallel *par, t_job *job)
+{
+	char	**argv;
+
+	dup2(job->out, STDOUT_FILENO);
+	dup2(job->err, STDERR_FILENO);
+	argv = parallel_argv(par->cmd, job->arg);
+	global_status()->nbr = 126;
+	if (argv && is_executable(tools, argv, tools->env))
+		exec_path(tools, argv, tools->env);
+	if (argv)
+		free_list(argv);
+	free_and_exit(tools, global_status()->nbr);
+}
+
+/**
+ * @brief Starts the next job in the given slot.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param par The parallel structure.
+ * @param job The free slot to start the job in.
+ */
+void	parallel_spawn(t_tools *tools, t_parallel *par, t_job *job)
+{
+	job->id = par->next + 1;
+	job->arg = par->args[par->next++];
+	job->out = anon_file();
+	job->err = anon_file();
+	if (job->out >= 0 && job->err >= 0)
+		job->pid = fork();
+	if (job->out < 0 || job->err < 0 || job->pid < 0)
+	{
+		perror("minishell: parallel");
+		if (job->out >= 0)
+			close(job->out);
+		if (job->err >= 0)
+			close(job->err);
+		job->pid = 0;
+		par->stop = 1;
+		return ;
+	}
+	if (job->pid == 0)
+		parallel_child(tools, par, job);
+	par->running++;
+}
+
+/**
+ * @brief Flushes the output of a finished job and reports its exit status.
+ * 
+ * @param par The parallel structure.
+ * @param job The job that just exited.
+ * @param status The raw status returned by waitpid().
+ */
+void	parallel_finish(t_parallel *par, t_job *job, int status)
+{
+	int	code;
+
+	code = 0;
+	if (WIFEXITED(status))
+		code = WEXITSTATUS(status);
+	else if (WIFSIGNALED(status))
+		code = 128 + WTERMSIG(status);
+	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGINT)
+		par->stop = 1;
+	lseek(job->out, 0, SEEK_SET);
+	copy_fd(job->out, STDOUT_FILENO);
+	lseek(job->err, 0, SEEK_SET);
+	copy_fd(job->err, STDERR_FILENO);
+	close(job->out);
+	close(job->err);
+	ft_putstr_fd("parallel: [", STDERR_FILENO);
+	ft_putnbr_fd(job->id, STDERR_FILENO);
+	ft_putstr_fd("] exit ", STDERR_FILENO);
+	ft_putnbr_fd(code, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putendl_fd(job->arg, STDERR_FILENO);
+	if (code)
+		par->failed++;
+	job->pid = 0;
+	par->running--;
+}
+
+/**
+ * @brief Waits for a job to exit and frees its slot.
+ * 
+ * Only the job pids are reaped: other children of the shell, like those
+ * of process substitutions, are left for their owner to wait for. When
+ * no job has exited yet, waitid() with WNOWAIT blocks until some child
+ * has, without reaping it. If that child is not a job, it stays a zombie
+ * and the next waitid() returns at once, so the loop then backs off for
+ * a millisecond instead of spinning.
+ * 
+ * @param par The parallel structure.
+ */
+void	parallel_reap(t_parallel *par)
+{
+	siginfo_t	info;
+	int			status;
+	int			slot;
+
+	slot = -1;
+	while (++slot < par->jobs)
+	{
+		if (par->slots[slot].pid && waitpid(par->slots[slot].pid, &status,
+				WNOHANG) > 0)
+		{
+			parallel_finish(par, &par->slots[slot], status);
+			return ;
+		}
+	}
+	info.si_pid = 0;
+	if (waitid(P_ALL, 0, &info, WEXITED | WNOWAIT) < 0 && errno != EINTR)
+		par->running = 0;
+	slot = 0;
+	while (slot < par->jobs && par->slots[slot].pid != info.si_pid)
+		slot++;
+	if (info.si_pid && slot == par->jobs)
+		usleep(1000);
+}
+
+/**
+ * @brief Keeps every job slot busy until all arguments are processed.
+ * 
+ * Free slots are refilled right after a child is reaped, so there are always
+ * min(N, remaining) children running. An interrupted job stops the loop
+ * from starting new ones, but the running ones are still collected.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param par The parallel structure.
+ */
+void	parallel_run(t_tools *tools, t_parallel *par)
+{
+	int	slot;
+
+	while ((!par->stop && par->next < par->nargs) || par->running)
+	{
+		slot = 0;
+		while (!par->stop && par->next < par->nargs && slot < par->jobs)
+		{
+			if (!par->slots[slot].pid)
+				parallel_spawn(tools, par, &par->slots[slot]);
+			slot++;
+		}
+		if (par->running)
+			parallel_reap(par);
+	}
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_printf.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:07:09 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:07:09 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Prints an error of the printf builtin.
+ * 
+ * Conversion errors don't stop the output, they only make printf exit
+ * with status 1.
+ * 
+ * @param pf The printf state, or NULL.
+ * @param arg The offending argument, or NULL.
+ * @param msg The error message.
+ */
+void	printf_err(t_printf *pf, char *arg, char *msg)
+{
+	ft_putstr_fd("minishell: printf: ", STDERR_FILENO);
+	if (arg)
+	{
+		ft_putstr_fd(arg, STDERR_FILENO);
+		ft_putstr_fd(": ", STDERR_FILENO);
+	}
+	ft_putendl_fd(msg, STDERR_FILENO);
+	if (pf)
+		pf->status = EXIT_FAILURE;
+}
+
+/**
+ * @brief Goes through the format once.
+ * 
+ * @param pf The printf state.
+ * @param fmt The format.
+ */
+static void	printf_once(t_printf *pf, char *fmt)
+{
+	int	i;
+	int	used;
+
+	i = 0;
+	while (fmt[i] && !pf->stop)
+	{
+		used = 1;
+		if (fmt[i] == '\\')
+			used = printf_escape(pf, fmt + i, 0);
+		else if (fmt[i] == '%')
+			used = printf_directive(pf, fmt + i);
+		else
+			printf_put(pf, fmt + i, 1);
+		i += used;
+	}
+}
+
+/**
+ * @brief Parses "-v var" and "--".
+ * 
+ * @param str The arguments.
+ * @param i The index of the current argument, advanced past the options.
+ * @param var Where to store the variable name.
+ * 
+ * @return 1 on success, 0 on a usage error.
+ */
+static int	printf_options(char **str, int *i, char **var)
+{
+	*var = NULL;
+	if (str[*i] && ft_strcmp(str[*i], "-v") == 0)
+	{
+		if (!str[*i + 1])
+		{
+			printf_err(NULL, "-v", "option requires an argument");
+			return (0);
+		}
+		*var = str[*i + 1];
+		*i += 2;
+		if (!is_valid_name(*var))
+		{
+			ft_putstr_fd("minishell: printf: `", STDERR_FILENO);
+			ft_putstr_fd(*var, STDERR_FILENO);
+			ft_putendl_fd("': not a valid identifier", STDERR_FILENO);
+			return (0);
+		}
+	}
+	if (str[*i] && ft_strcmp(str[*i], "--") == 0)
+		(*i)++;
+	if (str[*i])
+		return (1);
+	printf_err(NULL, "usage", "printf [-v var] format [arguments]");
+	return (0);
+}
+
+/**
+ * @brief The printf builtin.
+ * 
+ * The format is reused as long as it consumes arguments and some are
+ * left, so "printf '%s=%s\n' a 1 b 2" prints two lines. Everything is
+ * formatted into one buffer, which is either written through the builtin
+ * output or, with -v, assigned to the variable without any subshell.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The printf command.
+ * 
+ * @return 0 on success, 1 if an argument could not be converted, 2 on
+ * usage errors.
+ */
+int	cmd_printf(t_tools *tools, t_parser *command)
+{
+	t_printf	pf;
+	char		*var;
+	int			start;
+	int			i;
+
+	ft_memset(&pf, 0, sizeof(t_printf));
+	i = 1;
+	global_status()->nbr = 2;
+	if (!printf_options(command->str, &i, &var) || !printf_put(&pf, "", 0))
+		return (global_status()->nbr);
+	pf.args = command->str + i + 1;
+	pf.argc = count_lines(pf.args);
+	start = -1;
+	while (!pf.stop && pf.pos > start && (start < 0 || pf.pos < pf.argc))
+	{
+		start = pf.pos;
+		printf_once(&pf, command->str[i]);
+	}
+	if (var)
+		set_var(tools, var, pf.out);
+	else
+		output_write(pf.out, pf.len);
+	free(pf.out);
+	global_status()->nbr = pf.status;
+	return (pf.status);
+}
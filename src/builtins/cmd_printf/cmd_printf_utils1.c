@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_printf_utils1.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:05:10 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:05:10 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Appends bytes to the printf output, growing it as needed.
+ * 
+ * The output is always NUL terminated so it can be assigned with -v.
+ * With a NULL string the space is only reserved.
+ * 
+ * @param pf The printf state.
+ * @param str The bytes, or NULL.
+ * @param len How many bytes.
+ * 
+ * @return 1 on success, 0 if memory ran out.
+ */
+int	printf_put(t_printf *pf, char *str, size_t len)
+{
+	size_t	size;
+
+	if (pf->len + len + 1 > pf->size)
+	{
+		size = pf->size * 2 + len + 64;
+		pf->out = ft_realloc(pf->out, size, pf->size);
+		if (!pf->out)
+			return (0);
+		pf->size = size;
+	}
+	if (!str)
+		return (1);
+	ft_memcpy(pf->out + pf->len, str, len);
+	pf->len += len;
+	pf->out[pf->len] = '\0';
+	return (1);
+}
+
+/**
+ * @brief Formats one value with the C library and appends the result.
+ * 
+ * The conversion spec was built from an already validated directive, so
+ * the argument always matches it.
+ * 
+ * @param pf The printf state.
+ * @param spec The C conversion spec.
+ * @param ... The value.
+ */
+void	printf_format(t_printf *pf, char *spec, ...)
+{
+	va_list	args;
+	va_list	copy;
+	int		n;
+
+	va_start(args, spec);
+	va_copy(copy, args);
+	n = vsnprintf(NULL, 0, spec, copy);
+	va_end(copy);
+	if (n >= 0 && printf_put(pf, NULL, n))
+	{
+		vsnprintf(pf->out + pf->len, n + 1, spec, args);
+		pf->len += n;
+	}
+	va_end(args);
+}
+
+/**
+ * @brief Reads the digits of an octal or hexadecimal escape.
+ * 
+ * @param str The digits.
+ * @param base 8 or 16.
+ * @param max The maximum number of digits.
+ * @param value Where to store the value.
+ * 
+ * @return The number of digits used.
+ */
+static int	printf_code(char *str, int base, int max, int *value)
+{
+	int		i;
+	int		code;
+	char	*digits;
+	char	*p;
+
+	digits = "0123456789abcdef";
+	code = 0;
+	i = 0;
+	while (i < max && str[i])
+	{
+		p = ft_strchr(digits, ft_tolower(str[i]));
+		if (!p || p - digits >= base)
+			break ;
+		code = code * base + (p - digits);
+		i++;
+	}
+	if (i)
+		*value = code;
+	return (i);
+}
+
+/**
+ * @brief Expands one backslash escape.
+ * 
+ * The format string takes \\nnn octal escapes; %b arguments take \\0nnn
+ * and \\c, which stops all further output. Unknown escapes are printed as
+ * they are.
+ * 
+ * @param pf The printf state.
+ * @param str The escape, starting at the backslash.
+ * @param in_b 1 when expanding a %b argument.
+ * 
+ * @return The number of characters used.
+ */
+int	printf_escape(t_printf *pf, char *str, int in_b)
+{
+	char	*p;
+	char	c;
+	int		value;
+	int		used;
+
+	p = ft_strchr(PRINTF_ESCAPES, str[1]);
+	value = -1;
+	used = 0;
+	if (in_b && str[1] == '0')
+		value = 0;
+	if (str[1] && p)
+		value = PRINTF_VALUES[p - PRINTF_ESCAPES];
+	else if (str[1] == 'c' && in_b)
+		pf->stop = 1;
+	else if (str[1] == 'x' || (in_b && str[1] == '0'))
+		used = printf_code(str + 2, 16 - 8 * (str[1] == '0'),
+				3 - (str[1] == 'x'), &value);
+	else if (!in_b && str[1] >= '0' && str[1] <= '7')
+		used = printf_code(str + 1, 8, 3, &value) - 1;
+	if (value < 0 && !pf->stop)
+		printf_put(pf, "\\", 1);
+	c = (char)value;
+	if (value >= 0)
+		printf_put(pf, &c, 1);
+	return (used + 1 + (value >= 0 || pf->stop));
+}
+
+/**
+ * @brief Expands the backslash escapes of a %b argument.
+ * 
+ * @param pf The printf state, whose stop flag is set on \\c.
+ * @param str The argument.
+ * 
+ * @return The expanded string, or NULL if memory ran out.
+ */
+char	*printf_expand(t_printf *pf, char *str)
+{
+	t_printf	tmp;
+	int			i;
+
+	ft_memset(&tmp, 0, sizeof(t_printf));
+	printf_put(&tmp, "", 0);
+	i = 0;
+	while (tmp.out && str[i] && !tmp.stop)
+	{
+		if (str[i] == '\\')
+			i += printf_escape(&tmp, str + i, 1);
+		else
+			printf_put(&tmp, str + i++, 1);
+	}
+	if (tmp.stop)
+		pf->stop = 1;
+	return (tmp.out);
+}
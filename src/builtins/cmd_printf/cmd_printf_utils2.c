@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_printf_utils2.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:06:00 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:06:00 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Reads a width or precision: digits, or '*' to take an argument.
+ * 
+ * @param pf The printf state.
+ * @param fmt The format, at the width or precision.
+ * @param value Where to store the number.
+ * 
+ * @return The number of characters used.
+ */
+static int	printf_amount(t_printf *pf, char *fmt, int *value)
+{
+	int	i;
+
+	if (*fmt == '*')
+	{
+		*value = (int)printf_integer(pf, printf_next_arg(pf), 1);
+		if (*value == INT_MIN)
+			*value = -INT_MAX;
+		return (1);
+	}
+	*value = 0;
+	i = 0;
+	while (ft_isdigit(fmt[i]))
+	{
+		if (*value < INT_MAX / 10)
+			*value = *value * 10 + fmt[i] - '0';
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Parses a directive up to its conversion character.
+ * 
+ * Length modifiers are accepted and ignored, since every value is
+ * converted as the widest type. A negative '*' precision means no
+ * precision.
+ * 
+ * @param pf The printf state.
+ * @param fmt The format, at the '%'.
+ * @param spec Where to store the parsed directive.
+ * 
+ * @return The index of the conversion character.
+ */
+static int	printf_spec(t_printf *pf, char *fmt, t_spec *spec)
+{
+	int	i;
+	int	n;
+
+	ft_memset(spec, 0, sizeof(t_spec));
+	spec->prec = -1;
+	i = 1;
+	n = 0;
+	while (fmt[i] && ft_strchr("-+ #0", fmt[i]))
+	{
+		if (n < 6)
+			spec->flags[n++] = fmt[i];
+		i++;
+	}
+	if (fmt[i] == '*' || ft_isdigit(fmt[i]))
+		i += printf_amount(pf, fmt + i, &spec->width);
+	if (fmt[i] == '.')
+		i += 1 + printf_amount(pf, fmt + i + 1, &spec->prec);
+	if (spec->prec < 0)
+		spec->prec = -1;
+	while (fmt[i] && ft_strchr("hlLjzt", fmt[i]))
+		i++;
+	spec->conv = fmt[i];
+	return (i);
+}
+
+/**
+ * @brief Builds the C conversion spec of a directive.
+ * 
+ * Integers are converted as long long, floats as long double, and %b and
+ * %q become %s once their argument has been turned into a string.
+ * A negative width, which only '*' can give, means left alignment.
+ * 
+ * @param spec The parsed directive.
+ */
+static void	printf_spec_string(t_spec *spec)
+{
+	int	n;
+
+	n = snprintf(spec->c, sizeof(spec->c), "%%%s", spec->flags);
+	if (spec->width < 0)
+		n += snprintf(spec->c + n, sizeof(spec->c) - n, "-%d", -spec->width);
+	else if (spec->width > 0)
+		n += snprintf(spec->c + n, sizeof(spec->c) - n, "%d", spec->width);
+	if (spec->prec >= 0)
+		n += snprintf(spec->c + n, sizeof(spec->c) - n, ".%d", spec->prec);
+	if (ft_strchr("diouxX", spec->conv))
+		n += snprintf(spec->c + n, sizeof(spec->c) - n, "ll");
+	else if (ft_strchr("eEfFgGaA", spec->conv))
+		n += snprintf(spec->c + n, sizeof(spec->c) - n, "L");
+	if (ft_strchr("diouxXeEfFgGaAc", spec->conv))
+		snprintf(spec->c + n, sizeof(spec->c) - n, "%c", spec->conv);
+	else
+		snprintf(spec->c + n, sizeof(spec->c) - n, "s");
+}
+
+/**
+ * @brief Converts the next argument according to a directive.
+ * 
+ * @param pf The printf state.
+ * @param spec The parsed directive.
+ * @param arg The argument.
+ */
+static void	printf_convert(t_printf *pf, t_spec *spec, char *arg)
+{
+	char	*str;
+
+	printf_spec_string(spec);
+	if (ft_strchr("di", spec->conv))
+		printf_format(pf, spec->c, (long long)printf_integer(pf, arg, 1));
+	else if (ft_strchr("ouxX", spec->conv))
+		printf_format(pf, spec->c, printf_integer(pf, arg, 0));
+	else if (ft_strchr("eEfFgGaA", spec->conv))
+		printf_format(pf, spec->c, printf_float(pf, arg));
+	else if (spec->conv == 'c')
+		printf_format(pf, spec->c, (int)(unsigned char)arg[0]);
+	else
+	{
+		str = printf_text(pf, spec->conv, arg);
+		if (str)
+			printf_format(pf, spec->c, str);
+		free(str);
+	}
+}
+
+/**
+ * @brief Handles one directive of the format.
+ * 
+ * @param pf The printf state.
+ * @param fmt The format, at the '%'.
+ * 
+ * @return The number of characters used, or 0 after an invalid directive,
+ * which stops the output.
+ */
+int	printf_directive(t_printf *pf, char *fmt)
+{
+	t_spec	spec;
+	char	bad[4];
+	int		i;
+
+	i = printf_spec(pf, fmt, &spec);
+	if (spec.conv == '%')
+		printf_put(pf, "%", 1);
+	else if (spec.conv && ft_strchr("diouxXeEfFgGaAcsbq", spec.conv))
+		printf_convert(pf, &spec, printf_next_arg(pf));
+	else
+	{
+		bad[0] = '`';
+		bad[1] = spec.conv;
+		bad[2] = '\'';
+		bad[3] = '\0';
+		if (!spec.conv)
+			printf_err(pf, "`%'", "missing format character");
+		else
+			printf_err(pf, bad, "invalid format character");
+		pf->stop = 1;
+		return (0);
+	}
+	return (i + 1);
+}
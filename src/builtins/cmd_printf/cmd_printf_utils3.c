@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_printf_utils3.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:06:40 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:06:40 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Returns the next argument, or an empty one when they ran out.
+ * 
+ * Missing arguments count as empty strings or zero, as POSIX requires.
+ * 
+ * @param pf The printf state.
+ * 
+ * @return The argument.
+ */
+char	*printf_next_arg(t_printf *pf)
+{
+	if (pf->pos < pf->argc)
+		return (pf->args[pf->pos++]);
+	return ("");
+}
+
+/**
+ * @brief Reports a numeric argument that was not fully converted.
+ * 
+ * @param pf The printf state.
+ * @param arg The argument.
+ * @param end Where the conversion stopped.
+ */
+static void	printf_check(t_printf *pf, char *arg, char *end)
+{
+	if (errno == ERANGE)
+		printf_err(pf, arg, "Numerical result out of range");
+	else if (end == arg || *end)
+		printf_err(pf, arg, "invalid number");
+}
+
+/**
+ * @brief Converts an argument of an integer directive.
+ * 
+ * Decimal, octal (leading 0) and hexadecimal (leading 0x) are accepted,
+ * and a leading quote gives the code of the next character. On error the
+ * part that could be converted is used and the exit status becomes 1.
+ * 
+ * @param pf The printf state.
+ * @param arg The argument.
+ * @param is_signed 1 for %d and %i.
+ * 
+ * @return The value.
+ */
+unsigned long long	printf_integer(t_printf *pf, char *arg, int is_signed)
+{
+	unsigned long long	value;
+	char				*end;
+
+	if (!*arg)
+		return (0);
+	if (*arg == '\'' || *arg == '"')
+		return ((unsigned char)arg[1]);
+	errno = 0;
+	if (is_signed)
+		value = (unsigned long long)strtoll(arg, &end, 0);
+	else
+		value = strtoull(arg, &end, 0);
+	printf_check(pf, arg, end);
+	return (value);
+}
+
+/**
+ * @brief Converts an argument of a floating point directive.
+ * 
+ * @param pf The printf state.
+ * @param arg The argument.
+ * 
+ * @return The value.
+ */
+long double	printf_float(t_printf *pf, char *arg)
+{
+	long double	value;
+	char		*end;
+
+	if (!*arg)
+		return (0);
+	if (*arg == '\'' || *arg == '"')
+		return ((unsigned char)arg[1]);
+	errno = 0;
+	value = strtold(arg, &end);
+	printf_check(pf, arg, end);
+	return (value);
+}
+
+/**
+ * @brief Turns the argument of %s, %b or %q into the string to print.
+ * 
+ * @param pf The printf state.
+ * @param conv The conversion character.
+ * @param arg The argument.
+ * 
+ * @return A new string, or NULL if memory ran out.
+ */
+char	*printf_text(t_printf *pf, char conv, char *arg)
+{
+	if (conv == 'b')
+		return (printf_expand(pf, arg));
+	if (conv == 'q')
+		return (printf_quote(arg));
+	return (ft_strdup(arg));
+}
@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_printf_utils4.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:06:47 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:06:47 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Checks if a character can be printed without quoting.
+ * 
+ * @param c The character.
+ * 
+ * @return 1 if it is a letter, a digit, a byte of a multibyte character
+ * or one of PRINTF_SAFE.
+ */
+static int	quote_safe(unsigned char c)
+{
+	return (ft_isalnum(c) || c >= 128 || (c && ft_strchr(PRINTF_SAFE, c)));
+}
+
+/**
+ * @brief Appends one character in $'...' form.
+ * 
+ * @param pf The output being built.
+ * @param c The character.
+ */
+static void	quote_ansi_char(t_printf *pf, unsigned char c)
+{
+	char	*p;
+	char	code[5];
+
+	p = ft_strchr(PRINTF_VALUES, c);
+	if (c && p && c != '"')
+	{
+		code[0] = '\\';
+		code[1] = PRINTF_ESCAPES[p - PRINTF_VALUES];
+		printf_put(pf, code, 2);
+	}
+	else if (c < 32 || c == 127)
+	{
+		code[0] = '\\';
+		code[1] = '0' + (c >> 6);
+		code[2] = '0' + ((c >> 3) & 7);
+		code[3] = '0' + (c & 7);
+		printf_put(pf, code, 4);
+	}
+	else
+		printf_put(pf, (char *)&c, 1);
+}
+
+/**
+ * @brief Quotes a string that has control characters as $'...'.
+ * 
+ * @param pf The output being built.
+ * @param str The string.
+ */
+static void	quote_ansi(t_printf *pf, char *str)
+{
+	printf_put(pf, "$'", 2);
+	while (*str)
+		quote_ansi_char(pf, *str++);
+	printf_put(pf, "'", 1);
+}
+
+/**
+ * @brief Quotes a string so the shell reads it back as the same word.
+ * 
+ * This is %q: an empty string becomes '', strings with control characters
+ * use $'...' and anything else gets a backslash before every character
+ * that is special to the shell.
+ * 
+ * @param str The string.
+ * 
+ * @return A new string, or NULL if memory ran out.
+ */
+char	*printf_quote(char *str)
+{
+	t_printf	pf;
+	int			plain;
+	int			i;
+
+	ft_memset(&pf, 0, sizeof(t_printf));
+	printf_put(&pf, NULL, ft_strlen(str) * 2 + 3);
+	i = 0;
+	while (str[i] && !((unsigned char)str[i] < 32 || str[i] == 127))
+		i++;
+	plain = (*str && !str[i]);
+	if (!*str)
+		printf_put(&pf, "''", 2);
+	else if (!plain)
+		quote_ansi(&pf, str);
+	i = 0;
+	while (plain && str[i])
+	{
+		if (!quote_safe(str[i]))
+			printf_put(&pf, "\\", 1);
+		printf_put(&pf, str + i++, 1);
+	}
+	return (pf.out);
+}
@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/23 17:39:50 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/18 23:48:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -35,8 +35,8 @@ int	cmd_pwd(t_tools *tools, t_parser *command)
 		tools->oldpwd = get_var_from_env(tools->env, "OLDPWD");
 		ft_strcpy(buf, tools->pwd);
 	}
-	ft_putstr_fd(buf, STDOUT_FILENO);
-	ft_putstr_fd("\n", STDOUT_FILENO);
+	output_str(buf);
+	output_write("\n", 1);
 	global_status()->nbr = EXIT_SUCCESS;
 	return (global_status()->nbr);
 }
@@ -0,0 +1,188 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_read.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:02:03 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:02:03 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Prints an error of the read builtin and sets the exit status.
+ * 
+ * @param arg The offending argument, or NULL.
+ * @param msg The error message.
+ * @param status The exit status.
+ * 
+ * @return 0, so option parsing can return it directly.
+ */
+static int	read_err(char *arg, char *msg, int status)
+{
+	ft_putstr_fd("minishell: read: ", STDERR_FILENO);
+	if (arg)
+	{
+		ft_putstr_fd(arg, STDERR_FILENO);
+		ft_putstr_fd(": ", STDERR_FILENO);
+	}
+	ft_putendl_fd(msg, STDERR_FILENO);
+	global_status()->nbr = status;
+	return (0);
+}
+
+/**
+ * @brief Applies an option that takes a value: -d, -n or -u.
+ * 
+ * @param rd The read state.
+ * @param opt The option letter.
+ * @param value Its value.
+ * 
+ * @return 1 on success, 0 on an invalid value.
+ */
+static int	read_option(t_read *rd, char opt, char *value)
+{
+	int	i;
+
+	if (opt == 'd')
+	{
+		rd->delim = (unsigned char)value[0];
+		return (1);
+	}
+	i = 0;
+	while (ft_isdigit(value[i]))
+		i++;
+	if (!i || value[i] || i > 9)
+	{
+		if (opt == 'n')
+			return (read_err(value, "invalid number", 1));
+		return (read_err(value, "invalid file descriptor specification", 1));
+	}
+	if (opt == 'n')
+		rd->nchars = ft_atol(value);
+	else
+		rd->fd = ft_atoi(value);
+	if (opt == 'u' && fcntl(rd->fd, F_GETFD) < 0)
+		return (read_err(value, "invalid file descriptor: Bad file "
+				"descriptor", 1));
+	return (1);
+}
+
+/**
+ * @brief Parses the options of the read builtin.
+ * 
+ * Options may be grouped, as in "-rd ''", and the value of -d, -n and -u
+ * may be glued to the letter or be the next argument.
+ * 
+ * @param rd The read state.
+ * @param str The arguments.
+ * @param i The index of the current argument, advanced past the options.
+ * 
+ * @return 1 on success, 0 on a usage error.
+ */
+static int	read_options(t_read *rd, char **str, int *i)
+{
+	char	*arg;
+	char	*value;
+
+	while (str[*i] && str[*i][0] == '-' && str[*i][1])
+	{
+		arg = str[(*i)++];
+		if (ft_strcmp(arg, "--") == 0)
+			break ;
+		while (*(++arg) == 'r')
+			rd->raw = 1;
+		if (!*arg)
+			continue ;
+		if (!ft_strchr("dnu", *arg))
+			return (read_err(str[*i - 1], "invalid option\nread: usage: "
+					"read [-r] [-d delim] [-n nchars] [-u fd] [name ...]", 2));
+		value = arg + 1;
+		if (!*value && !str[*i])
+			return (read_err(str[*i - 1], "option requires an argument", 2));
+		if (!*value)
+			value = str[(*i)++];
+		if (!read_option(rd, *arg, value))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief Reads one line and assigns it to the variables.
+ * 
+ * The variables are assigned even at end of file, with whatever was read
+ * before it.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param rd The read state.
+ * @param vars The variable names.
+ * 
+ * @return 0 if the delimiter or the -n limit was reached, 1 otherwise.
+ */
+static int	read_line(t_tools *tools, t_read *rd, char **vars)
+{
+	int	complete;
+
+	rd->ifs = get_var_from_env(tools->env, "IFS");
+	if (!rd->ifs)
+		rd->ifs = ft_strdup(" \t\n");
+	rd->size = 64;
+	rd->line = ft_calloc(rd->size, 1);
+	rd->esc = ft_calloc(rd->size, 1);
+	complete = 0;
+	if (rd->ifs && rd->line && rd->esc)
+	{
+		complete = read_input(rd);
+		read_assign(tools, rd, vars);
+	}
+	free(rd->ifs);
+	free(rd->line);
+	free(rd->esc);
+	return (!complete);
+}
+
+/**
+ * @brief The read builtin.
+ * 
+ * Reads a line from stdin (or the -u descriptor), splits it on IFS and
+ * assigns the fields to the given variables, or to REPLY when there are
+ * none. Regular files are read through a buffer kept between calls, so
+ * reading a big file line by line costs one read(2) per 64K instead of
+ * one per byte; see read_char() and read_sync().
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command The read command.
+ * 
+ * @return 0 if a full line was read, 1 on end of file, 2 on usage errors.
+ */
+int	cmd_read(t_tools *tools, t_parser *command)
+{
+	t_read	rd;
+	char	*reply[2];
+	char	**vars;
+	int		i;
+
+	rd = (t_read){STDIN_FILENO, 0, '\n', -1, NULL, NULL, NULL, 0, 0};
+	i = 1;
+	if (!read_options(&rd, command->str, &i))
+		return (global_status()->nbr);
+	reply[0] = "REPLY";
+	reply[1] = NULL;
+	vars = command->str + i;
+	if (!*vars)
+		vars = reply;
+	i = 0;
+	while (vars[i] && is_valid_name(vars[i]))
+		i++;
+	if (vars[i])
+	{
+		read_err(vars[i], "not a valid identifier", 1);
+		return (1);
+	}
+	global_status()->nbr = read_line(tools, &rd, vars);
+	return (global_status()->nbr);
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_read_utils1.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:01:30 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:01:30 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Returns the read buffers, one per low file descriptor.
+ * 
+ * @return The READ_FDS buffers.
+ */
+static t_read_buf	*read_buffers(void)
+{
+	static t_read_buf	buffers[READ_FDS];
+
+	return (buffers);
+}
+
+/**
+ * @brief Decides how a descriptor can be read.
+ * 
+ * Seekable descriptors are read in big chunks, since whatever was read
+ * past the delimiter can be given back with lseek before anybody else
+ * uses the descriptor. Pipes and terminals cannot give data back, and
+ * they may be shared with other processes, so they are read one byte at
+ * a time.
+ * 
+ * @param fd The descriptor.
+ * @param buf Its buffer.
+ */
+static void	read_mode(int fd, t_read_buf *buf)
+{
+	buf->start = 0;
+	buf->end = 0;
+	if (lseek(fd, 0, SEEK_CUR) < 0)
+		buf->mode = READ_BYTE;
+	else
+		buf->mode = READ_CHUNK;
+}
+
+/**
+ * @brief Reads one character for the read builtin.
+ * 
+ * @param fd The descriptor to read from.
+ * @param c Where to store the character.
+ * 
+ * @return 1 if a character was read, 0 on end of file, -1 on error.
+ */
+int	read_char(int fd, char *c)
+{
+	t_read_buf	*buf;
+	ssize_t		n;
+
+	if (fd < 0 || fd >= READ_FDS)
+		return (read(fd, c, 1));
+	buf = &read_buffers()[fd];
+	if (buf->mode == READ_UNKNOWN)
+		read_mode(fd, buf);
+	if (buf->mode == READ_BYTE)
+		return (read(fd, c, 1));
+	if (buf->start == buf->end)
+	{
+		n = read(fd, buf->data, READ_BUFFER);
+		if (n <= 0)
+			return (n);
+		buf->start = 0;
+		buf->end = n;
+	}
+	*c = buf->data[buf->start++];
+	return (1);
+}
+
+/**
+ * @brief Gives back the data read ahead and forgets every read buffer.
+ * 
+ * Must be called before the descriptors can change or be used by someone
+ * else: before forking, before applying or undoing redirections and before
+ * exec. The file offsets are moved back so the next reader starts right
+ * after the last character the read builtin consumed.
+ */
+void	read_sync(void)
+{
+	t_read_buf	*buf;
+	int			fd;
+
+	fd = 0;
+	while (fd < READ_FDS)
+	{
+		buf = &read_buffers()[fd];
+		if (buf->mode == READ_CHUNK && buf->end > buf->start)
+			lseek(fd, -(off_t)(buf->end - buf->start), SEEK_CUR);
+		buf->mode = READ_UNKNOWN;
+		buf->start = 0;
+		buf->end = 0;
+		fd++;
+	}
+}
+
+/**
+ * @brief Reads characters up to the delimiter, end of file or the limit.
+ * 
+ * Without -r a backslash quotes the next character and a backslash
+ * followed by a newline is a line continuation. NUL bytes are dropped.
+ * 
+ * @param rd The read state.
+ * 
+ * @return 1 if the delimiter or the -n limit was reached, 0 on end of file
+ * or error.
+ */
+int	read_input(t_read *rd)
+{
+	char	c;
+	int		escaped;
+
+	escaped = 0;
+	while (rd->nchars < 0 || (long)rd->len < rd->nchars)
+	{
+		if (read_char(rd->fd, &c) <= 0)
+			return (0);
+		if (escaped && c != '\n' && !read_push(rd, c, 1))
+			return (0);
+		else if (escaped)
+			escaped = 0;
+		else if ((unsigned char)c == rd->delim)
+			return (1);
+		else if (c == '\\' && !rd->raw)
+			escaped = 1;
+		else if (c && !read_push(rd, c, 0))
+			return (0);
+	}
+	return (1);
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_read_utils2.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:01:41 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:01:41 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Appends a character to the line being read.
+ * 
+ * Characters escaped with a backslash are remembered so field splitting
+ * treats them as ordinary characters even if they are in IFS.
+ * 
+ * @param rd The read state.
+ * @param c The character.
+ * @param escaped 1 if the character was escaped.
+ * 
+ * @return 1 on success, 0 if memory ran out.
+ */
+int	read_push(t_read *rd, char c, int escaped)
+{
+	size_t	size;
+
+	if (rd->len + 1 >= rd->size)
+	{
+		size = rd->size * 2 + 64;
+		rd->line = ft_realloc(rd->line, size, rd->size);
+		rd->esc = ft_realloc(rd->esc, size, rd->size);
+		rd->size = size;
+		if (!rd->line || !rd->esc)
+			return (0);
+	}
+	rd->line[rd->len] = c;
+	rd->esc[rd->len] = escaped;
+	rd->len++;
+	rd->line[rd->len] = '\0';
+	return (1);
+}
+
+/**
+ * @brief Checks if the character at a position separates fields.
+ * 
+ * @param rd The read state.
+ * @param i The position in the line.
+ * @param white 1 to only accept IFS white space (space, tab, newline).
+ * 
+ * @return 1 if it is an IFS character of the requested kind.
+ */
+static int	read_is_ifs(t_read *rd, size_t i, int white)
+{
+	char	c;
+
+	c = rd->line[i];
+	if (rd->esc[i] || !ft_strchr(rd->ifs, c))
+		return (0);
+	if (white)
+		return (c == ' ' || c == '\t' || c == '\n');
+	return (1);
+}
+
+/**
+ * @brief Skips IFS white space starting at a position.
+ * 
+ * @param rd The read state.
+ * @param pos The start position.
+ * 
+ * @return The first position that is not IFS white space.
+ */
+static size_t	read_skip_white(t_read *rd, size_t pos)
+{
+	while (pos < rd->len && read_is_ifs(rd, pos, 1))
+		pos++;
+	return (pos);
+}
+
+/**
+ * @brief Finds the end of the field that starts at a position.
+ * 
+ * The last variable takes the rest of the line, without the trailing IFS
+ * white space.
+ * 
+ * @param rd The read state.
+ * @param pos The start of the field.
+ * @param last 1 if the field goes to the last variable.
+ * 
+ * @return The position just past the field.
+ */
+static size_t	read_field_end(t_read *rd, size_t pos, int last)
+{
+	size_t	end;
+
+	if (!last)
+	{
+		while (pos < rd->len && !read_is_ifs(rd, pos, 0))
+			pos++;
+		return (pos);
+	}
+	end = rd->len;
+	while (end > pos && read_is_ifs(rd, end - 1, 1))
+		end--;
+	return (end);
+}
+
+/**
+ * @brief Splits the line on IFS and assigns the fields to the variables.
+ * 
+ * Runs of IFS white space count as a single separator and are ignored at
+ * both ends, other IFS characters separate exactly one field each. Extra
+ * variables are set to the empty string.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param rd The read state.
+ * @param vars The variable names.
+ */
+void	read_assign(t_tools *tools, t_read *rd, char **vars)
+{
+	size_t	pos;
+	size_t	end;
+	char	*value;
+
+	pos = read_skip_white(rd, 0);
+	while (*vars)
+	{
+		end = read_field_end(rd, pos, vars[1] == NULL);
+		value = ft_substr(rd->line, pos, end - pos);
+		if (value)
+			set_var(tools, *vars, value);
+		free(value);
+		pos = read_skip_white(rd, end);
+		if (pos < rd->len && read_is_ifs(rd, pos, 0))
+			pos = read_skip_white(rd, pos + 1);
+		vars++;
+	}
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_source.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:56:24 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:34:42 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/builtins.h"
+
+/**
+ * @brief Prints an error of the source builtin and sets the exit status.
+ * 
+ * @param file The file name, or NULL.
+ * @param msg The error message.
+ * @param status The exit status.
+ * 
+ * @return The exit status.
+ */
+static int	source_err(char *file, char *msg, int status)
+{
+	ft_putstr_fd("minishell: source: ", STDERR_FILENO);
+	if (file)
+	{
+		ft_putstr_fd(file, STDERR_FILENO);
+		ft_putstr_fd(": ", STDERR_FILENO);
+	}
+	ft_putendl_fd(msg, STDERR_FILENO);
+	global_status()->nbr = status;
+	return (status);
+}
+
+/**
+ * @brief Reads a whole file and splits it into lines.
+ * 
+ * @param file The file name.
+ * 
+ * @return The lines, or NULL with errno set on error.
+ */
+static char	**source_read(char *file)
+{
+	char	*data;
+	char	**lines;
+	int		fd;
+
+	fd = open(file, O_RDONLY);
+	if (fd < 0)
+		return (NULL);
+	data = read_fd(fd, NULL);
+	close(fd);
+	if (!data)
+		return (NULL);
+	lines = split_lines(data);
+	free(data);
+	return (lines);
+}
+
+/**
+ * @brief Switches the shell over to the lines of a sourced file.
+ * 
+ * The current script state and command are saved, so here-documents read
+ * their bodies from the sourced file and the command being run survives
+ * the commands of the file. Extra arguments become the positional
+ * parameters; $0 is left alone.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param saved Where the current state is saved.
+ * @param lines The lines of the file.
+ * @param str The arguments of the source command.
+ */
+static void	source_enter(t_tools *tools, t_source *saved, char **lines,
+		char **str)
+{
+	char	**argv;
+
+	*saved = (t_source){tools->lines, tools->line_count, tools->nint_mode,
+		tools->pipes, tools->parser, shell_params()->argv};
+	tools->lines = lines;
+	tools->line_count = 0;
+	tools->nint_mode = 1;
+	tools->parser = NULL;
+	tools->sourcing++;
+	if (!str[2] || !saved->argv)
+		return ;
+	argv = list_dup(str, 1, count_lines(str));
+	if (!argv)
+		return ;
+	free(argv[0]);
+	argv[0] = ft_strdup(saved->argv[0]);
+	shell_params()->argv = argv;
+}
+
+/**
+ * @brief Goes back to the state saved by source_enter().
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param saved The saved state.
+ */
+static void	source_leave(t_tools *tools, t_source *saved)
+{
+	if (shell_params()->argv != saved->argv)
+		free_list(shell_params()->argv);
+	shell_params()->argv = saved->argv;
+	free_list(tools->lines);
+	tools->lines = saved->lines;
+	tools->line_count = saved->line_count;
+	tools->nint_mode = saved->nint_mode;
+	tools->pipes = saved->pipes;
+	tools->parser = saved->parser;
+	tools->sourcing--;
+	tools->returns = 0;
+}
+
+/**
+ * @brief Executes the source and . builtins.
+ * 
+ * The lines of the file go through the same lexer, parser and executor as
+ * the lines typed at the prompt, inside the shell process, so variables
+ * exported by the file stay set and builtins cost no fork.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command Pointer to the parsed source command.
+ * 
+ * @return The exit status of the last command of the file.
+ */
+int	cmd_source(t_tools *tools, t_parser *command)
+{
+	t_source	saved;
+	char		**lines;
+
+	if (!command->str[1])
+		return (source_err(NULL, "filename argument required", 2));
+	if (tools->sourcing >= MAX_SOURCE_DEPTH)
+		return (source_err(command->str[1], "nesting level too deep", 1));
+	lines = source_read(command->str[1]);
+	if (!lines)
+		return (source_err(command->str[1], strerror(errno), 1));
+	source_enter(tools, &saved, lines, command->str);
+	global_status()->nbr = EXIT_SUCCESS;
+	while (tools->lines[tools->line_count] && !tools->exit
+		&& !tools->returns)
+	{
+		tools->line_count++;
+		execute_line(tools, tools->lines[tools->line_count - 1]);
+	}
+	source_leave(tools, &saved);
+	return (global_status()->nbr);
+}
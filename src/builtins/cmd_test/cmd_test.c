@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_test.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:58:26 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/18 23:58:54 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Reports a syntax error in a test expression.
+ * 
+ * Only the first error is printed; the expression is then abandoned and
+ * test exits with status 2.
+ * 
+ * @param test The expression being evaluated.
+ * @param arg The offending argument, or NULL.
+ * @param msg The error message.
+ * 
+ * @return 0, so callers can return it as the result of the expression.
+ */
+int	test_err(t_test *test, char *arg, char *msg)
+{
+	if (!test->error)
+	{
+		ft_putstr_fd("minishell: ", STDERR_FILENO);
+		ft_putstr_fd(test->name, STDERR_FILENO);
+		ft_putstr_fd(": ", STDERR_FILENO);
+		if (arg)
+		{
+			ft_putstr_fd(arg, STDERR_FILENO);
+			ft_putstr_fd(": ", STDERR_FILENO);
+		}
+		ft_putendl_fd(msg, STDERR_FILENO);
+	}
+	test->error = 1;
+	return (0);
+}
+
+/**
+ * @brief Evaluates a term: "! term", "( expression )" or a primary.
+ * 
+ * As POSIX requires for three arguments, a binary operator in second
+ * position wins over a leading '!' or '('.
+ * 
+ * @param test The expression being evaluated.
+ * 
+ * @return The truth value of the term.
+ */
+int	test_term(t_test *test)
+{
+	int	result;
+
+	if (test->pos >= test->argc)
+		return (test_err(test, NULL, "argument expected"));
+	if (test->pos + 2 < test->argc && is_test_binary(test->argv[test->pos + 1]))
+		return (test_binary(test));
+	if (ft_strcmp(test->argv[test->pos], "!") == 0)
+	{
+		test->pos++;
+		return (!test_term(test));
+	}
+	if (ft_strcmp(test->argv[test->pos], "(") == 0)
+	{
+		test->pos++;
+		result = test_or(test);
+		if (test->pos >= test->argc || ft_strcmp(test->argv[test->pos], ")"))
+			return (test_err(test, NULL, "`)' expected"));
+		test->pos++;
+		return (result);
+	}
+	return (test_primary(test));
+}
+
+/**
+ * @brief Evaluates terms joined by -a.
+ * 
+ * @param test The expression being evaluated.
+ * 
+ * @return The truth value of the conjunction.
+ */
+int	test_and(t_test *test)
+{
+	int	result;
+	int	next;
+
+	result = test_term(test);
+	while (!test->error && test->pos < test->argc
+		&& ft_strcmp(test->argv[test->pos], "-a") == 0)
+	{
+		test->pos++;
+		next = test_term(test);
+		result = result && next;
+	}
+	return (result);
+}
+
+/**
+ * @brief Evaluates conjunctions joined by -o.
+ * 
+ * @param test The expression being evaluated.
+ * 
+ * @return The truth value of the expression.
+ */
+int	test_or(t_test *test)
+{
+	int	result;
+	int	next;
+
+	result = test_and(test);
+	while (!test->error && test->pos < test->argc
+		&& ft_strcmp(test->argv[test->pos], "-o") == 0)
+	{
+		test->pos++;
+		next = test_and(test);
+		result = result || next;
+	}
+	return (result);
+}
+
+/**
+ * @brief Executes the test and [ builtins.
+ * 
+ * The expression is evaluated in the shell process, so conditions in
+ * loops cost no fork. With no arguments the result is false.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param command Pointer to the parsed test command.
+ * 
+ * @return 0 if the expression is true, 1 if it is false, 2 on error.
+ */
+int	cmd_test(t_tools *tools, t_parser *command)
+{
+	t_test	test;
+	int		result;
+
+	(void)tools;
+	test = (t_test){command->str[0], command->str + 1,
+		count_lines(command->str) - 1, 0, 0};
+	result = 0;
+	if (ft_strcmp(test.name, "[") == 0 && (test.argc == 0
+			|| ft_strcmp(test.argv[--test.argc], "]")))
+		test_err(&test, NULL, "missing `]'");
+	if (!test.error && test.argc > 0)
+		result = test_or(&test);
+	if (!test.error && test.pos < test.argc)
+		test_err(&test, test.argv[test.pos], "too many arguments");
+	global_status()->nbr = !result;
+	if (test.error)
+		global_status()->nbr = 2;
+	return (global_status()->nbr);
+}
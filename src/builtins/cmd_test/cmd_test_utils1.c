@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_test_utils1.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:58:26 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/18 23:58:54 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Evaluates a file type or mode operator on a stat() result.
+ * 
+ * @param op The operator letter.
+ * @param st The file status.
+ * 
+ * @return The truth value of the operator.
+ */
+static int	test_stat(char op, struct stat *st)
+{
+	static char		*letters = "fdbcpSguk";
+	static mode_t	modes[] = {S_IFREG, S_IFDIR, S_IFBLK, S_IFCHR, S_IFIFO,
+		S_IFSOCK, S_ISGID, S_ISUID, S_ISVTX};
+	char			*found;
+
+	found = ft_strchr(letters, op);
+	if (found && found - letters < 6)
+		return ((st->st_mode & S_IFMT) == modes[found - letters]);
+	if (found)
+		return ((st->st_mode & modes[found - letters]) != 0);
+	if (op == 's')
+		return (st->st_size > 0);
+	if (op == 'O')
+		return (st->st_uid == geteuid());
+	if (op == 'G')
+		return (st->st_gid == getegid());
+	if (op == 'N')
+		return (timespec_newer(&st->st_mtim, &st->st_atim));
+	return (op == 'e');
+}
+
+/**
+ * @brief Evaluates a unary operator.
+ * 
+ * Each file operator costs a single system call: lstat() for -h and -L,
+ * faccessat() for -r, -w and -x, and stat() for all the others.
+ * 
+ * @param test The expression being evaluated.
+ * @param op The operator letter.
+ * @param arg The operand.
+ * 
+ * @return The truth value of the operator.
+ */
+static int	test_unary(t_test *test, char op, char *arg)
+{
+	struct stat	st;
+	long long	fd;
+
+	if (op == 'n' || op == 'z')
+		return ((arg[0] != '\0') == (op == 'n'));
+	if (op == 't')
+	{
+		if (!test_number(test, arg, &fd))
+			return (0);
+		return (fd >= 0 && fd <= INT_MAX && isatty(fd));
+	}
+	if (op == 'r')
+		return (faccessat(AT_FDCWD, arg, R_OK, AT_EACCESS) == 0);
+	if (op == 'w')
+		return (faccessat(AT_FDCWD, arg, W_OK, AT_EACCESS) == 0);
+	if (op == 'x')
+		return (faccessat(AT_FDCWD, arg, X_OK, AT_EACCESS) == 0);
+	if (op == 'h' || op == 'L')
+		return (lstat(arg, &st) == 0 && S_ISLNK(st.st_mode));
+	return (stat(arg, &st) == 0 && test_stat(op, &st));
+}
+
+/**
+ * @brief Evaluates a primary: a unary operator and its operand, or a
+ * single string that is true when it is not empty.
+ * 
+ * @param test The expression being evaluated.
+ * 
+ * @return The truth value of the primary.
+ */
+int	test_primary(t_test *test)
+{
+	char	*op;
+
+	op = test->argv[test->pos];
+	if (op[0] == '-' && op[1] && !op[2] && ft_strchr(TEST_UNARY, op[1])
+		&& test->pos + 1 < test->argc)
+	{
+		test->pos += 2;
+		return (test_unary(test, op[1], test->argv[test->pos - 1]));
+	}
+	test->pos++;
+	return (op[0] != '\0');
+}
+
+/**
+ * @brief Parses an integer operand.
+ * 
+ * Leading and trailing blanks and a sign are accepted, like in bash.
+ * 
+ * @param test The expression being evaluated.
+ * @param str The operand.
+ * @param n Where to store the value.
+ * 
+ * @return 1 on success, 0 (with an error reported) otherwise.
+ */
+int	test_number(t_test *test, char *str, long long *n)
+{
+	int	i;
+	int	sign;
+	int	digits;
+
+	i = 0;
+	while (str[i] == ' ' || str[i] == '\t')
+		i++;
+	sign = 1;
+	if (str[i] == '-' || str[i] == '+')
+		sign = 44 - str[i++];
+	*n = 0;
+	digits = 0;
+	while (ft_isdigit(str[i]) && digits < 19)
+	{
+		*n = *n * 10 + sign * (str[i++] - '0');
+		digits++;
+	}
+	while (str[i] == ' ' || str[i] == '\t')
+		i++;
+	if (!digits || str[i])
+		return (test_err(test, str, "integer expression expected"));
+	return (1);
+}
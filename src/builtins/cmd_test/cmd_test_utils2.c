@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_test_utils2.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:58:26 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:45:10 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../../includes/builtins.h"
+
+/**
+ * @brief Tells if a timestamp is more recent than another.
+ * 
+ * @param a The first timestamp.
+ * @param b The second timestamp.
+ * 
+ * @return 1 if a is more recent than b, 0 otherwise.
+ */
+int	timespec_newer(struct timespec *a, struct timespec *b)
+{
+	if (a->tv_sec != b->tv_sec)
+		return (a->tv_sec > b->tv_sec);
+	return (a->tv_nsec > b->tv_nsec);
+}
+
+/**
+ * @brief Tells if a word is a binary operator of test.
+ * 
+ * -a and -o are handled by the expression parser, not here.
+ * 
+ * @param str The word.
+ * 
+ * @return 1 if it is a binary operator, 0 otherwise.
+ */
+int	is_test_binary(char *str)
+{
+	int			i;
+	static char	*ops[] = {"=", "==", "!=", "<", ">", "-eq", "-ne", "-lt",
+		"-le", "-gt", "-ge", "-nt", "-ot", "-ef", NULL};
+
+	i = 0;
+	while (ops[i])
+		if (ft_strcmp(ops[i++], str) == 0)
+			return (1);
+	return (0);
+}
+
+/**
+ * @brief Evaluates -nt, -ot and -ef, with one stat() per file.
+ * 
+ * A file that does not exist is older than one that does.
+ * 
+ * @param op The operator.
+ * @param a The first file.
+ * @param b The second file.
+ * 
+ * @return The truth value of the operator.
+ */
+static int	test_files(char *op, char *a, char *b)
+{
+	struct stat	sa;
+	struct stat	sb;
+	int			ea;
+	int			eb;
+
+	ea = stat(a, &sa);
+	eb = stat(b, &sb);
+	if (ft_strcmp(op, "-ef") == 0)
+		return (!ea && !eb && sa.st_dev == sb.st_dev
+			&& sa.st_ino == sb.st_ino);
+	if (ft_strcmp(op, "-nt") == 0)
+		return (!ea && (eb || timespec_newer(&sa.st_mtim, &sb.st_mtim)));
+	return (!eb && (ea || timespec_newer(&sb.st_mtim, &sa.st_mtim)));
+}
+
+/**
+ * @brief Evaluates an integer comparison.
+ * 
+ * @param test The expression being evaluated.
+ * @param op The operator.
+ * @param a The first operand.
+ * @param b The second operand.
+ * 
+ * @return The truth value of the comparison.
+ */
+static int	test_integers(t_test *test, char *op, char *a, char *b)
+{
+	long long	x;
+	long long	y;
+
+	if (!test_number(test, a, &x) || !test_number(test, b, &y))
+		return (0);
+	if (ft_strcmp(op, "-eq") == 0)
+		return (x == y);
+	if (ft_strcmp(op, "-ne") == 0)
+		return (x != y);
+	if (ft_strcmp(op, "-lt") == 0)
+		return (x < y);
+	if (ft_strcmp(op, "-le") == 0)
+		return (x <= y);
+	if (ft_strcmp(op, "-gt") == 0)
+		return (x > y);
+	return (x >= y);
+}
+
+/**
+ * @brief Evaluates a binary operator and its two operands.
+ * 
+ * @param test The expression being evaluated.
+ * 
+ * @return The truth value of the operator.
+ */
+int	test_binary(t_test *test)
+{
+	char	*a;
+	char	*op;
+	char	*b;
+
+	a = test->argv[test->pos];
+	op = test->argv[test->pos + 1];
+	b = test->argv[test->pos + 2];
+	test->pos += 3;
+	if (ft_strcmp(op, "=") == 0 || ft_strcmp(op, "==") == 0)
+		return (ft_strcmp(a, b) == 0);
+	if (ft_strcmp(op, "!=") == 0)
+		return (ft_strcmp(a, b) != 0);
+	if (ft_strcmp(op, "<") == 0)
+		return (ft_strcmp(a, b) < 0);
+	if (ft_strcmp(op, ">") == 0)
+		return (ft_strcmp(a, b) > 0);
+	if (!ft_strcmp(op, "-nt") || !ft_strcmp(op, "-ot")
+		|| !ft_strcmp(op, "-ef"))
+		return (test_files(op, a, b));
+	return (test_integers(test, op, a, b));
+}
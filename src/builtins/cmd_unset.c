@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/23 17:40:34 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -94,6 +94,8 @@ void	unset_var_from_env(t_tools *tools, char *str, int i)
  * 
  * This function unsets specified variables from 
  * the environment by removing them from the environment array.
+ * A name that is not a variable is unset as an array, or else, as is any
+ * name after -f, as a shell function.
  * 
  * @param tools   Pointer to the tools struct containing environment information.
  * @param command Pointer to the parser struct containing command information.
@@ -104,15 +106,22 @@ int	cmd_unset(t_tools *tools, t_parser *command)
 {
 	int	i;
 	int	pos;
+	int	func;
 
 	i = 1;
 	pos = 0;
 	if (!command->str[i])
 		ft_putstr_fd("\n", STDOUT_FILENO);
+	func = (command->str[i] && ft_strcmp(command->str[i], "-f") == 0);
+	i += func;
 	while (command->str[i])
 	{
-		if (check_var(tools, command->str[i]))
+		if (!func && check_var(tools, command->str[i]))
 			unset_var_from_env(tools, command->str[i], pos);
+		else if (!func && array_find(command->str[i]))
+			hash_del(shell_arrays(), command->str[i]);
+		else
+			hash_del(shell_functions(), command->str[i]);
 		i++;
 	}
 	global_status()->nbr = EXIT_SUCCESS;
@@ -0,0 +1,177 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:19:50 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:38:11 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Parses a list of pipelines separated by ";" or newlines.
+ * 
+ * @param ctl The control parser.
+ * @param stops The reserved words closing the list, separated by spaces, or
+ * NULL for the whole input.
+ * 
+ * @return The list, NULL if it is empty.
+ */
+t_node	*ctl_list(t_ctl *ctl, char *stops)
+{
+	t_node	*head;
+	t_node	*node;
+
+	head = NULL;
+	ctl_skip(ctl);
+	while (!ctl_stop(ctl, stops))
+	{
+		node = ctl_pipeline(ctl);
+		if (!node)
+			break ;
+		node_append(&head, node);
+		node_body(ctl, node);
+		if (ctl->type == CTL_SEMI || ctl->type == CTL_NEWLINE)
+			ctl_next(ctl);
+		else if (!ctl_stop(ctl, NULL))
+			ctl_error(ctl);
+		ctl_skip(ctl);
+	}
+	return (head);
+}
+
+/**
+ * @brief Prompts for the next line of an unfinished command.
+ * 
+ * Ctrl-C abandons the command, like at a here-document prompt.
+ * 
+ * @param tools Pointer to the tools structure.
+ * 
+ * @return The line, or NULL at end-of-file or on Ctrl-C.
+ */
+static char	*compound_prompt(t_tools *tools)
+{
+	char	*line;
+	int		status;
+
+	status = global_status()->nbr;
+	global_status()->sigint = 0;
+	handle_heredoc_sigaction();
+	line = readline("> ");
+	handle_sigaction();
+	if (!global_status()->sigint)
+	{
+		global_status()->nbr = status;
+		return (line);
+	}
+	free(line);
+	dup2(tools->original_stdin, STDIN_FILENO);
+	return (NULL);
+}
+
+/**
+ * @brief Appends the next line to an unfinished command.
+ * 
+ * Scripts take it from the lines that follow, the terminal from a "> "
+ * prompt.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param src The command so far. It is freed.
+ * 
+ * @return The longer command, or NULL if there is no next line.
+ */
+static char	*compound_more(t_tools *tools, char *src)
+{
+	char	*line;
+	char	*joined;
+
+	line = NULL;
+	if (tools->nint_mode && tools->lines[tools->line_count])
+		line = ft_strdup(tools->lines[tools->line_count++]);
+	else if (!tools->nint_mode)
+		line = compound_prompt(tools);
+	joined = NULL;
+	if (line)
+		joined = append_len(append_len(src, "\n", 1), line, ft_strlen(line));
+	else
+		free(src);
+	if (!line && !global_status()->sigint)
+	{
+		ft_putstr_fd("minishell: syntax error: unexpected end of file\n",
+			STDERR_FILENO);
+		global_status()->nbr = 2;
+	}
+	free(line);
+	return (joined);
+}
+
+/**
+ * @brief Parses a whole command line into a command tree.
+ * 
+ * The parser works on a copy of the line, which alias expansion rewrites,
+ * so the line can be parsed again from scratch once more of it is read.
+ * 
+ * @param ctl The control parser to use.
+ * @param src The command line.
+ * 
+ * @return The command tree. ctl->error and ctl->incomplete tell whether it
+ * can run.
+ */
+static t_node	*compound_parse(t_ctl *ctl, char *src)
+{
+	t_node	*tree;
+
+	ft_bzero(ctl, sizeof(t_ctl));
+	ctl->src = ft_strdup(src);
+	ctl->error = (ctl->src == NULL);
+	if (ctl->error)
+		return (NULL);
+	ctl_next(ctl);
+	tree = ctl_list(ctl, NULL);
+	if (ctl->type != CTL_EOF)
+		ctl_error(ctl);
+	while (ctl->ndelims)
+		free(ctl->delims[--ctl->ndelims]);
+	free(ctl->src);
+	ctl->src = NULL;
+	return (tree);
+}
+
+/**
+ * @brief Parses and runs a command line with its control structures.
+ * 
+ * if, while, until, for and case may span several lines, which are read
+ * until the command is complete. The whole tree is parsed once, so loop
+ * bodies are not parsed again on each iteration.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param line The command line.
+ */
+void	compound_line(t_tools *tools, char *line)
+{
+	t_ctl	ctl;
+	t_node	*tree;
+	char	*src;
+
+	global_status()->sigint = 0;
+	src = ft_strdup(line);
+	tree = NULL;
+	if (src)
+		tree = compound_parse(&ctl, src);
+	while (src && ctl.incomplete)
+	{
+		node_free(tree);
+		tree = NULL;
+		src = compound_more(tools, src);
+		if (src)
+			tree = compound_parse(&ctl, src);
+	}
+	if (src && !ctl.error)
+		exec_list(tools, tree);
+	node_free(tree);
+	free(src);
+}
@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_alias.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:36:12 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:38:11 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Tells whether an alias was already expanded for the current word.
+ * 
+ * @param ctl The control parser.
+ * @param name The name of the alias.
+ * 
+ * @return 1 if it was, 0 otherwise.
+ */
+static int	ctl_aliased(t_ctl *ctl, char *name)
+{
+	int	i;
+
+	i = 0;
+	while (i < ctl->naliases)
+	{
+		if (ft_strcmp(ctl->aliased[i], name) == 0)
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Writes the value of an alias over the current word of the source.
+ * 
+ * The token is then read again from the start of the value.
+ * 
+ * @param ctl The control parser.
+ * @param value The value of the alias.
+ * 
+ * @return 1 on success, 0 if memory ran out.
+ */
+static int	ctl_splice(t_ctl *ctl, char *value)
+{
+	char	*src;
+	size_t	len;
+
+	len = ft_strlen(value);
+	src = ft_substr(ctl->src, 0, ctl->start);
+	src = append_len(src, value, len);
+	src = append_len(src, ctl->src + ctl->end,
+			ft_strlen(ctl->src + ctl->end));
+	if (!src)
+		return (0);
+	free(ctl->src);
+	ctl->src = src;
+	ctl->alias_next = 0;
+	if (len && (value[len - 1] == ' ' || value[len - 1] == '\t'))
+		ctl->alias_next = ctl->start + len;
+	ctl->pos = ctl->start;
+	ctl->end = ctl->start;
+	ctl_next(ctl);
+	return (1);
+}
+
+/**
+ * @brief Expands the current word if it names an alias.
+ * 
+ * Quoted words never match, since alias names cannot hold quotes. An
+ * alias met again while expanding the same word is left alone, so
+ * "alias ls='ls -F'" and alias loops end.
+ * 
+ * @param ctl The control parser.
+ * 
+ * @return 1 if the word was expanded, 0 otherwise.
+ */
+static int	ctl_alias(t_ctl *ctl)
+{
+	char	*name;
+	char	*value;
+
+	if (ctl->type != CTL_WORD || ctl->naliases >= MAX_ALIAS_DEPTH)
+		return (0);
+	name = ctl_text(ctl);
+	value = NULL;
+	if (name && !ctl_aliased(ctl, name))
+		value = hash_get(shell_aliases(), name);
+	if (!value)
+	{
+		free(name);
+		return (0);
+	}
+	ctl->aliased[ctl->naliases++] = name;
+	if (ctl_splice(ctl, value))
+		return (1);
+	ctl->error = 1;
+	return (0);
+}
+
+/**
+ * @brief Expands the aliases of a word in command position.
+ * 
+ * This happens while the line is parsed, once, so aliases cost nothing
+ * when the command runs, and an alias can expand to several commands or
+ * to a compound command.
+ * 
+ * When the last value ends with a blank, the word that follows it is
+ * checked too, as in "alias sudo='sudo '".
+ * 
+ * @param ctl The control parser, on the word.
+ * 
+ * @return 1 if the word was expanded, 0 otherwise.
+ */
+int	ctl_aliases(t_ctl *ctl)
+{
+	int	expanded;
+
+	ctl->alias_next = 0;
+	expanded = 1;
+	while (expanded)
+		expanded = ctl_alias(ctl);
+	expanded = (ctl->naliases > 0);
+	while (ctl->naliases)
+		free(ctl->aliased[--ctl->naliases]);
+	return (expanded);
+}
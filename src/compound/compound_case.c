@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_case.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:19:16 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:28:44 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Parses one "pattern) commands ;;" item of a case command.
+ * 
+ * @param ctl The control parser, on the first pattern or its "(".
+ * 
+ * @return The new NODE_ITEM node, or NULL on error.
+ */
+static t_node	*ctl_item(t_ctl *ctl)
+{
+	t_node	*item;
+
+	item = node_new(ctl, NODE_ITEM);
+	if (!item)
+		return (NULL);
+	if (ctl->type == CTL_LPAREN)
+		ctl_next(ctl);
+	while (ctl_want(ctl, CTL_WORD))
+	{
+		item->words = list_add(item->words, ctl_text(ctl));
+		if (!item->words)
+			ctl->error = 1;
+		ctl_next(ctl);
+		if (ctl->type != CTL_PIPE)
+			break ;
+		ctl_next(ctl);
+	}
+	if (!ctl_want(ctl, CTL_RPAREN))
+		return (item);
+	ctl_next(ctl);
+	item->list = ctl_list(ctl, "esac");
+	if (ctl->type == CTL_DSEMI)
+		ctl_next(ctl);
+	return (item);
+}
+
+/**
+ * @brief Parses a case command.
+ * 
+ * The subject and the patterns are kept raw and expanded each time the
+ * command runs.
+ * 
+ * @param ctl The control parser, on the case.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_case(t_ctl *ctl)
+{
+	t_node	*node;
+	t_node	*item;
+
+	node = node_new(ctl, NODE_CASE);
+	if (!node)
+		return (NULL);
+	ctl_next(ctl);
+	if (!ctl_want(ctl, CTL_WORD))
+		return (node);
+	node->text = ctl_text(ctl);
+	ctl_next(ctl);
+	ctl_skip(ctl);
+	ctl->error |= (node->text == NULL);
+	if (!ctl_expect(ctl, "in"))
+		return (node);
+	ctl_skip(ctl);
+	while (!ctl_is(ctl, "esac") && !ctl_stop(ctl, NULL))
+	{
+		item = ctl_item(ctl);
+		node_append(&node->list, item);
+		ctl_skip(ctl);
+	}
+	ctl_expect(ctl, "esac");
+	return (node);
+}
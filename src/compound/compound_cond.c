@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_cond.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:40:47 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:45:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Finds the end of the right operand of "=~".
+ * 
+ * Parentheses and '|' belong to a regular expression, so the operand runs
+ * to the first blank outside quotes and parentheses.
+ * 
+ * @param s The source text.
+ * @param i Index of the first character of the operand.
+ * 
+ * @return The index just past the operand, or -1 if a quote is left open.
+ */
+static int	cond_regex_end(char *s, int i)
+{
+	int	depth;
+
+	depth = 0;
+	while (i >= 0 && s[i] && (depth || !ft_strchr(" \t\n", s[i])))
+	{
+		if (s[i] == '\'' || s[i] == '"')
+			i = quoted_end(s, i);
+		else if (s[i] == '\\' && s[i + 1])
+			i += 2;
+		else
+		{
+			depth += (s[i] == '(') - (s[i] == ')' && depth);
+			i++;
+		}
+	}
+	return (i);
+}
+
+/**
+ * @brief Reads one word of a conditional command.
+ * 
+ * Operators are words here too: "&&", "||", "(", ")", "<" and ">". The
+ * right operand of "=~" is read as a regular expression.
+ * 
+ * @param ctl The control parser, on the word.
+ * @param regex 1 if the word follows "=~", else 0.
+ * 
+ * @return The newly allocated word, or NULL on error.
+ */
+static char	*cond_word(t_ctl *ctl, int regex)
+{
+	if (regex)
+	{
+		ctl->end = cond_regex_end(ctl->src, ctl->start);
+		if (ctl->end < 0)
+		{
+			ctl->incomplete = 1;
+			return (NULL);
+		}
+		ctl->pos = ctl->end;
+	}
+	else if (ctl->type == CTL_PIPE && ctl->src[ctl->end] == '|')
+		ctl->pos = ++ctl->end;
+	else if (ctl->type != CTL_WORD && ctl->type != CTL_OP
+		&& ctl->type != CTL_LPAREN && ctl->type != CTL_RPAREN)
+	{
+		ctl_error(ctl);
+		return (NULL);
+	}
+	return (ctl_text(ctl));
+}
+
+/**
+ * @brief Parses a "[[ expression ]]" conditional command.
+ * 
+ * The words of the expression are kept raw. They are expanded when the
+ * command runs, without splitting or globbing, and only as far as the
+ * expression needs them.
+ * 
+ * @param ctl The control parser, on the "[[".
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_cond(t_ctl *ctl)
+{
+	t_node	*node;
+	char	*word;
+	int		regex;
+
+	node = node_new(ctl, NODE_COND);
+	if (!node)
+		return (NULL);
+	ctl_next(ctl);
+	ctl_skip(ctl);
+	regex = 0;
+	while (!ctl_is(ctl, "]]") && !ctl_stop(ctl, NULL))
+	{
+		word = cond_word(ctl, regex);
+		regex = (word && !ft_strcmp(word, "=~"));
+		node->words = list_add(node->words, word);
+		ctl->error |= (!node->words && !ctl->incomplete);
+		ctl_next(ctl);
+		ctl_skip(ctl);
+	}
+	if (!node->words && ctl_is(ctl, "]]"))
+		ctl_error(ctl);
+	ctl_expect(ctl, "]]");
+	return (node);
+}
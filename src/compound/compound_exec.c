@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_exec.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:19:59 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:30:11 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Tells whether the rest of a command list must be skipped.
+ * 
+ * That is the case after exit, break, continue, return or Ctrl-C.
+ * 
+ * @param tools Pointer to the tools structure.
+ * 
+ * @return 1 if it must, 0 otherwise.
+ */
+int	compound_stop(t_tools *tools)
+{
+	return (tools->exit || tools->breaks || tools->continues
+		|| tools->returns || global_status()->sigint);
+}
+
+/**
+ * @brief Runs an if command.
+ * 
+ * Like in bash, the status is 0 when no condition was true and there is
+ * no else branch.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The if node.
+ */
+static void	exec_if(t_tools *tools, t_node *node)
+{
+	exec_list(tools, node->cond);
+	if (compound_stop(tools))
+		return ;
+	if (global_status()->nbr == 0)
+		exec_list(tools, node->list);
+	else if (node->other)
+		exec_list(tools, node->other);
+	else
+		global_status()->nbr = 0;
+}
+
+/**
+ * @brief Runs a command, without its redirections.
+ * 
+ * A simple command gets a copy of the words split at parse time, which
+ * the lexer expands and tokenizes, unless it only assigns arrays.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The command.
+ */
+void	exec_compound(t_tools *tools, t_node *node)
+{
+	char	**words;
+
+	if (node->type == NODE_SIMPLE && !array_assign(tools, node->words))
+	{
+		words = list_dup(node->words, 0, count_lines(node->words));
+		if (words)
+			run_words(tools, words);
+	}
+	else if (node->type == NODE_IF)
+		exec_if(tools, node);
+	else if (node->type == NODE_WHILE || node->type == NODE_UNTIL)
+		exec_loop(tools, node);
+	else if (node->type == NODE_FOR)
+		exec_for(tools, node);
+	else if (node->type == NODE_CASE)
+		exec_case(tools, node);
+	else if (node->type == NODE_COND)
+		exec_cond(tools, node);
+	else if (node->type == NODE_PIPE)
+		exec_pipe(tools, node);
+	else if (node->type == NODE_GROUP)
+		exec_list(tools, node->list);
+	else if (node->type == NODE_FUNC)
+		func_define(node);
+}
+
+/**
+ * @brief Runs a command with its here-document bodies and redirections.
+ * 
+ * The bodies kept by the parser stand in for the script lines while the
+ * command runs, so a here-document inside a loop is read again on each
+ * iteration.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The command.
+ */
+void	exec_node(t_tools *tools, t_node *node)
+{
+	t_source	saved;
+
+	saved = (t_source){tools->lines, tools->line_count, tools->nint_mode,
+		tools->pipes, NULL, NULL};
+	if (node->body)
+	{
+		tools->lines = node->body;
+		tools->line_count = 0;
+		tools->nint_mode = 1;
+	}
+	if (node->redir)
+		exec_redirected(tools, node);
+	else if (node->type == NODE_TIME)
+		exec_time(tools, node);
+	else
+		exec_compound(tools, node);
+	if (!node->body)
+		return ;
+	tools->lines = saved.lines;
+	tools->line_count = saved.line_count;
+	tools->nint_mode = saved.nint_mode;
+}
+
+/**
+ * @brief Runs a list of commands in order.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The first command of the list.
+ */
+void	exec_list(t_tools *tools, t_node *node)
+{
+	while (node && !compound_stop(tools))
+	{
+		exec_node(tools, node);
+		node = node->next;
+	}
+}
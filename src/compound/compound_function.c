@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_function.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:31:44 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:45:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Tells whether the current word starts a function definition.
+ * 
+ * That is the function keyword, or a name followed by "(".
+ * 
+ * @param ctl The control parser.
+ * 
+ * @return 1 if it does, 0 otherwise.
+ */
+int	ctl_is_func(t_ctl *ctl)
+{
+	int	i;
+
+	if (ctl->type != CTL_WORD)
+		return (0);
+	if (ctl_is(ctl, "function"))
+		return (1);
+	i = ctl->end;
+	while (ctl->src[i] == ' ' || ctl->src[i] == '\t')
+		i++;
+	return (ctl->src[i] == '(');
+}
+
+/**
+ * @brief Parses a compound command, on one of the CTL_COMPOUND words.
+ * 
+ * @param ctl The control parser.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_compound(t_ctl *ctl)
+{
+	if (ctl_is(ctl, "if"))
+		return (ctl_if(ctl));
+	if (ctl_is(ctl, "while") || ctl_is(ctl, "until"))
+		return (ctl_loop(ctl));
+	if (ctl_is(ctl, "for"))
+		return (ctl_for(ctl));
+	if (ctl_is(ctl, "case"))
+		return (ctl_case(ctl));
+	if (ctl_is(ctl, "[["))
+		return (ctl_cond(ctl));
+	return (ctl_group(ctl));
+}
+
+/**
+ * @brief Parses a { ...; } group, up to and including its }.
+ * 
+ * @param ctl The control parser, on the {.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_group(t_ctl *ctl)
+{
+	t_node	*node;
+
+	node = node_new(ctl, NODE_GROUP);
+	if (!node)
+		return (NULL);
+	ctl_next(ctl);
+	node->list = ctl_list(ctl, "}");
+	ctl_expect(ctl, "}");
+	return (node);
+}
+
+/**
+ * @brief Reads the name of a function definition.
+ * 
+ * Names that would need expanding or quoting are refused.
+ * 
+ * @param ctl The control parser, on the name.
+ * @param node The definition.
+ * 
+ * @return 1 on success, 0 on error.
+ */
+static int	ctl_fname(t_ctl *ctl, t_node *node)
+{
+	int	i;
+
+	if (ctl->type != CTL_WORD)
+		return (ctl_want(ctl, CTL_WORD));
+	i = ctl->start;
+	while (i < ctl->end && !ft_strchr("'\"$`\\=", ctl->src[i]))
+		i++;
+	if (i < ctl->end || ctl_stop(ctl, CTL_RESERVED))
+	{
+		ctl_error(ctl);
+		return (0);
+	}
+	node->text = ctl_text(ctl);
+	ctl->error |= (node->text == NULL);
+	ctl_next(ctl);
+	return (node->text != NULL);
+}
+
+/**
+ * @brief Parses a function definition.
+ * 
+ * Both "name() body" and "function name [()] body" are accepted. The body
+ * has to be a compound command; its redirections are applied on each call.
+ * 
+ * @param ctl The control parser, on the name or the function keyword.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_function(t_ctl *ctl)
+{
+	t_node	*node;
+
+	node = node_new(ctl, NODE_FUNC);
+	if (!node)
+		return (NULL);
+	if (ctl_is(ctl, "function"))
+		ctl_next(ctl);
+	if (!ctl_fname(ctl, node))
+		return (node);
+	if (ctl->type == CTL_LPAREN)
+	{
+		ctl_next(ctl);
+		if (!ctl_want(ctl, CTL_RPAREN))
+			return (node);
+		ctl_next(ctl);
+	}
+	ctl_skip(ctl);
+	if (ctl->type == CTL_WORD && !ctl_stop(ctl, CTL_COMPOUND))
+		ctl_error(ctl);
+	else
+		node->list = ctl_command(ctl);
+	return (node);
+}
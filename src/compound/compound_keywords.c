@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_keywords.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:19:16 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:34:42 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Parses the "do ... done" body of a loop.
+ * 
+ * @param ctl The control parser, on the do.
+ * @param node The loop.
+ */
+static void	ctl_do(t_ctl *ctl, t_node *node)
+{
+	if (ctl_expect(ctl, "do"))
+	{
+		node->list = ctl_list(ctl, "done");
+		ctl_expect(ctl, "done");
+	}
+}
+
+/**
+ * @brief Parses the words after the "in" of a for loop.
+ * 
+ * @param ctl The control parser, on the in.
+ * @param node The for loop.
+ */
+static void	ctl_words(t_ctl *ctl, t_node *node)
+{
+	node->words = ft_calloc(1, sizeof(char *));
+	ctl_next(ctl);
+	while (node->words && ctl->type == CTL_WORD)
+	{
+		node->words = list_add(node->words, ctl_text(ctl));
+		ctl_next(ctl);
+	}
+	if (!node->words)
+		ctl->error = 1;
+}
+
+/**
+ * @brief Parses an if or elif clause, up to and including its fi.
+ * 
+ * An elif is parsed as a nested if in the else branch, which consumes the
+ * fi shared by the whole chain.
+ * 
+ * @param ctl The control parser, on the if or elif.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_if(t_ctl *ctl)
+{
+	t_node	*node;
+
+	node = node_new(ctl, NODE_IF);
+	if (!node)
+		return (NULL);
+	ctl_next(ctl);
+	node->cond = ctl_list(ctl, "then");
+	if (!ctl_expect(ctl, "then"))
+		return (node);
+	node->list = ctl_list(ctl, "elif else fi");
+	if (ctl_is(ctl, "elif"))
+	{
+		node->other = ctl_if(ctl);
+		return (node);
+	}
+	if (ctl_is(ctl, "else"))
+	{
+		ctl_next(ctl);
+		node->other = ctl_list(ctl, "fi");
+	}
+	ctl_expect(ctl, "fi");
+	return (node);
+}
+
+/**
+ * @brief Parses a while or until loop.
+ * 
+ * @param ctl The control parser, on the while or until.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_loop(t_ctl *ctl)
+{
+	t_node	*node;
+
+	if (ctl_is(ctl, "until"))
+		node = node_new(ctl, NODE_UNTIL);
+	else
+		node = node_new(ctl, NODE_WHILE);
+	if (!node)
+		return (NULL);
+	ctl_next(ctl);
+	node->cond = ctl_list(ctl, "do");
+	ctl_do(ctl, node);
+	return (node);
+}
+
+/**
+ * @brief Parses a for loop.
+ * 
+ * The words after "in" are kept raw and expanded each time the loop runs.
+ * Without "in", node->words stays NULL and the loop goes over "$@".
+ * 
+ * @param ctl The control parser, on the for.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_for(t_ctl *ctl)
+{
+	t_node	*node;
+
+	node = node_new(ctl, NODE_FOR);
+	if (!node)
+		return (NULL);
+	ctl_next(ctl);
+	if (!ctl_want(ctl, CTL_WORD))
+		return (node);
+	node->text = ctl_text(ctl);
+	if (!node->text || !is_valid_name(node->text))
+		ctl_error(ctl);
+	ctl_next(ctl);
+	ctl_skip(ctl);
+	if (ctl_is(ctl, "in"))
+		ctl_words(ctl, node);
+	if (ctl->type == CTL_SEMI || ctl->type == CTL_NEWLINE)
+		ctl_next(ctl);
+	ctl_skip(ctl);
+	ctl_do(ctl, node);
+	return (node);
+}
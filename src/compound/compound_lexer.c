@@ -0,0 +1,182 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_lexer.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:18:18 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:13:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Makes the delimiter of a here-document out of its raw word.
+ * 
+ * @param s The raw word.
+ * @param len Length of the word.
+ * 
+ * @return The word without its quotes, or NULL on allocation error.
+ */
+static char	*ctl_delim(char *s, int len)
+{
+	char	*delim;
+	int		i;
+	int		n;
+
+	delim = malloc(len + 1);
+	if (!delim)
+		return (NULL);
+	i = 0;
+	n = 0;
+	while (i < len)
+	{
+		if (s[i] != '\'' && s[i] != '"')
+			delim[n++] = s[i];
+		i++;
+	}
+	delim[n] = '\0';
+	return (delim);
+}
+
+/**
+ * @brief Reads an operator token.
+ * 
+ * Runs of redirection characters make a single CTL_OP token, like ">>" or
+ * ">&". A "<<" asks for the next word to be recorded as a here-document
+ * delimiter.
+ * 
+ * @param ctl The control parser.
+ * @param s The source text.
+ * @param i Index of the first character of the operator.
+ * 
+ * @return The index just past the operator.
+ */
+static int	ctl_op(t_ctl *ctl, char *s, int i)
+{
+	int	start;
+
+	start = i;
+	ctl->want_delim = 0;
+	ctl->type = CTL_OP;
+	if (s[i] == '\n')
+		ctl->type = CTL_NEWLINE;
+	else if (s[i] == ';' && s[i + 1] == ';')
+		ctl->type = CTL_DSEMI;
+	else if (s[i] == ';')
+		ctl->type = CTL_SEMI;
+	else if (s[i] == '|')
+		ctl->type = CTL_PIPE;
+	else if (s[i] == '(')
+		ctl->type = CTL_LPAREN;
+	else if (s[i] == ')')
+		ctl->type = CTL_RPAREN;
+	if (ctl->type != CTL_OP)
+		return (i + 1 + (ctl->type == CTL_DSEMI));
+	while (s[i] && ft_strchr("<>&", s[i]))
+		i++;
+	if (i - start == 2 && s[start] == '<')
+		ctl->want_delim = (s[start + 1] == '<');
+	return (i);
+}
+
+/**
+ * @brief Reads a word token.
+ * 
+ * A word left open by a quote or a substitution makes the input
+ * incomplete, so more lines are read before parsing again.
+ * 
+ * @param ctl The control parser.
+ * @param s The source text.
+ * @param i Index of the first character of the word.
+ */
+static void	ctl_word(t_ctl *ctl, char *s, int i)
+{
+	ctl->type = CTL_WORD;
+	ctl->end = ctl_word_end(s, i);
+	if (ctl->end < 0)
+	{
+		ctl->incomplete = 1;
+		ctl->type = CTL_EOF;
+		ctl->end = ft_strlen(s);
+	}
+	else if (ctl->want_delim && ctl->ndelims < MAX_PENDING_HEREDOCS)
+	{
+		ctl->delims[ctl->ndelims] = ctl_delim(s + i, ctl->end - i);
+		if (ctl->delims[ctl->ndelims])
+			ctl->ndelims++;
+	}
+	ctl->want_delim = 0;
+}
+
+/**
+ * @brief Skips the here-document bodies that follow a newline.
+ * 
+ * The bodies of the here-documents started on the line just ended come
+ * first on the next lines. They are not commands, so their range is kept
+ * aside and handed to the command that owns them.
+ * 
+ * @param ctl The control parser.
+ */
+static void	ctl_bodies(t_ctl *ctl)
+{
+	char	*s;
+	size_t	len;
+	int		i;
+	int		k;
+
+	s = ctl->src;
+	i = ctl->end;
+	ctl->body_start = i;
+	k = 0;
+	while (k < ctl->ndelims && s[i])
+	{
+		len = ft_strlen_nl(s + i);
+		if (len == ft_strlen(ctl->delims[k])
+			&& !ft_strncmp(s + i, ctl->delims[k], len))
+			k++;
+		i += len + (s[i + len] == '\n');
+	}
+	ctl->incomplete |= (k < ctl->ndelims);
+	while (ctl->ndelims)
+		free(ctl->delims[--ctl->ndelims]);
+	ctl->body_end = i;
+	ctl->end = i;
+	ctl->pos = i;
+}
+
+/**
+ * @brief Moves the control parser to the next token.
+ * 
+ * Blanks and comments are skipped. The end of the previous token is kept
+ * in last_end, so a simple command can be cut out of the source text.
+ * 
+ * @param ctl The control parser.
+ */
+void	ctl_next(t_ctl *ctl)
+{
+	char	*s;
+	int		i;
+
+	s = ctl->src;
+	ctl->last_end = ctl->end;
+	i = ctl->pos;
+	while (s[i] == ' ' || s[i] == '\t')
+		i++;
+	if (s[i] == '#')
+		while (s[i] && s[i] != '\n')
+			i++;
+	ctl->start = i;
+	ctl->end = i;
+	if (!s[i])
+		ctl->type = CTL_EOF;
+	else if (ft_strchr(CTL_METACHARS, s[i]) && !procsub_start(s, i))
+		ctl->end = ctl_op(ctl, s, i);
+	else
+		ctl_word(ctl, s, i);
+	ctl->pos = ctl->end;
+	if (ctl->type == CTL_NEWLINE && ctl->ndelims)
+		ctl_bodies(ctl);
+}
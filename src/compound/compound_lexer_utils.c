@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_lexer_utils.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:18:01 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Finds the end of a word of the control parser.
+ * 
+ * A word ends at an unquoted blank or operator character, except for the
+ * "<" or ">" of a process substitution.
+ * 
+ * @param s The source text.
+ * @param i Index of the first character of the word.
+ * 
+ * @return The index just past the word, or -1 if a quote or substitution
+ * is left open.
+ */
+int	ctl_word_end(char *s, int i)
+{
+	while (i >= 0 && s[i]
+		&& (!ft_strchr(CTL_METACHARS, s[i]) || procsub_start(s, i)))
+	{
+		if (s[i] == '\'' || s[i] == '"' || s[i] == '`')
+			i = quoted_end(s, i);
+		else if (bracket_start(s, i))
+			i = subst_end(s, i);
+		else
+			i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Tells whether the current token is a given unquoted word.
+ * 
+ * @param ctl The control parser.
+ * @param word The word, usually a reserved word.
+ * 
+ * @return 1 if it is, 0 otherwise.
+ */
+int	ctl_is(t_ctl *ctl, char *word)
+{
+	size_t	len;
+
+	len = ft_strlen(word);
+	return (ctl->type == CTL_WORD && (size_t)(ctl->end - ctl->start) == len
+		&& !ft_strncmp(ctl->src + ctl->start, word, len));
+}
+
+/**
+ * @brief Copies the text of the current token.
+ * 
+ * @param ctl The control parser.
+ * 
+ * @return The token text, or NULL on allocation error.
+ */
+char	*ctl_text(t_ctl *ctl)
+{
+	return (ft_substr(ctl->src, ctl->start, ctl->end - ctl->start));
+}
@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_loop.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:20:17 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:44:55 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Handles break, continue, return and interruptions at the end of a
+ * pass.
+ * 
+ * "break n" and "continue n" leave n - 1 enclosing loops on their way
+ * out; the last one either stops or goes on with its next pass. return
+ * leaves every loop of the function.
+ * 
+ * @param tools Pointer to the tools structure.
+ * 
+ * @return 1 if the loop must stop, 0 if it goes on.
+ */
+static int	loop_done(t_tools *tools)
+{
+	if (tools->returns)
+		return (1);
+	if (tools->breaks)
+	{
+		tools->breaks--;
+		return (1);
+	}
+	if (tools->continues > 1)
+	{
+		tools->continues--;
+		return (1);
+	}
+	tools->continues = 0;
+	return (tools->exit || global_status()->sigint);
+}
+
+/**
+ * @brief Runs a while or until loop.
+ * 
+ * The status is the one of the last pass of the body, or 0 if it never
+ * ran.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The loop.
+ */
+void	exec_loop(t_tools *tools, t_node *node)
+{
+	int	status;
+
+	status = 0;
+	tools->loop_depth++;
+	while (1)
+	{
+		exec_list(tools, node->cond);
+		if (compound_stop(tools) && loop_done(tools))
+			break ;
+		if ((global_status()->nbr == 0) == (node->type == NODE_UNTIL))
+			break ;
+		exec_list(tools, node->list);
+		status = global_status()->nbr;
+		if (compound_stop(tools) && loop_done(tools))
+			break ;
+	}
+	tools->loop_depth--;
+	if (!tools->exit && !tools->returns && !global_status()->sigint)
+		global_status()->nbr = status;
+}
+
+/**
+ * @brief Runs a for loop.
+ * 
+ * The words are expanded once, before the first pass.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The loop.
+ */
+void	exec_for(t_tools *tools, t_node *node)
+{
+	char	**words;
+	int		status;
+	int		i;
+
+	words = for_words(tools, node->words);
+	status = 0;
+	tools->loop_depth++;
+	i = 0;
+	while (words && words[i])
+	{
+		set_var(tools, node->text, words[i++]);
+		exec_list(tools, node->list);
+		status = global_status()->nbr;
+		if (compound_stop(tools) && loop_done(tools))
+			break ;
+	}
+	tools->loop_depth--;
+	if (words)
+		free_list(words);
+	if (!tools->exit && !global_status()->sigint)
+		global_status()->nbr = status;
+}
+
+/**
+ * @brief Tells whether the subject of a case matches one of the patterns
+ * of an item.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param item The case item.
+ * @param subject The expanded subject.
+ * 
+ * @return 1 if it does, 0 otherwise.
+ */
+static int	case_match(t_tools *tools, t_node *item, char *subject)
+{
+	char	*raw;
+	char	*pattern;
+	int		match;
+	int		i;
+
+	match = 0;
+	i = 0;
+	while (!match && item->words[i])
+	{
+		raw = case_pattern(item->words[i++]);
+		pattern = expand_word(tools, raw);
+		match = (pattern && match_pattern(pattern, subject));
+		free(raw);
+		free(pattern);
+	}
+	return (match);
+}
+
+/**
+ * @brief Runs a case command.
+ * 
+ * The commands of the first item with a matching pattern run. The status
+ * is 0 if none matched.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The case command.
+ */
+void	exec_case(t_tools *tools, t_node *node)
+{
+	t_node	*item;
+	char	*subject;
+
+	subject = expand_word(tools, node->text);
+	item = node->list;
+	while (subject && item && !case_match(tools, item, subject))
+		item = item->next;
+	if (subject && item && item->list)
+		exec_list(tools, item->list);
+	else
+		global_status()->nbr = 0;
+	free(subject);
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_node.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:19:38 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:34:42 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Allocates an empty node of the command tree.
+ * 
+ * @param ctl The control parser, flagged on allocation error.
+ * @param type The node type, one of the NODE_ values.
+ * 
+ * @return The new node, or NULL on allocation error.
+ */
+t_node	*node_new(t_ctl *ctl, int type)
+{
+	t_node	*node;
+
+	node = ft_calloc(1, sizeof(t_node));
+	if (!node)
+	{
+		ctl->error = 1;
+		return (NULL);
+	}
+	node->type = type;
+	return (node);
+}
+
+/**
+ * @brief Makes a simple command node out of a range of the source text.
+ * 
+ * The text is split into words once, here. Running the command only
+ * expands and tokenizes a copy of them, so a loop body is never split
+ * again on each iteration.
+ * 
+ * @param ctl The control parser.
+ * @param start Where the command starts in the source text.
+ * @param end Where it ends.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*node_simple(t_ctl *ctl, int start, int end)
+{
+	t_node	*node;
+
+	node = node_new(ctl, NODE_SIMPLE);
+	if (!node)
+		return (NULL);
+	node->text = ft_substr(ctl->src, start, end - start);
+	if (node->text)
+		node->words = lexer_split(node->text, 0);
+	if (!node->words)
+	{
+		ctl->error = 1;
+		node_free(node);
+		return (NULL);
+	}
+	return (node);
+}
+
+/**
+ * @brief Appends a node to a list of nodes.
+ * 
+ * @param head The head of the list.
+ * @param node The node to append. NULL is ignored.
+ */
+void	node_append(t_node **head, t_node *node)
+{
+	t_node	*last;
+
+	if (!node)
+		return ;
+	if (!*head)
+	{
+		*head = node;
+		return ;
+	}
+	last = *head;
+	while (last->next)
+		last = last->next;
+	last->next = node;
+}
+
+/**
+ * @brief Hands the here-document bodies just skipped to their command.
+ * 
+ * @param ctl The control parser.
+ * @param node The command the bodies belong to.
+ */
+void	node_body(t_ctl *ctl, t_node *node)
+{
+	char	*text;
+
+	if (ctl->body_end <= ctl->body_start)
+		return ;
+	text = ft_substr(ctl->src, ctl->body_start, ctl->body_end
+			- ctl->body_start);
+	if (text)
+		node->body = split_lines(text);
+	if (!node->body)
+		ctl->error = 1;
+	free(text);
+	ctl->body_start = 0;
+	ctl->body_end = 0;
+}
+
+/**
+ * @brief Frees a list of nodes and everything below them.
+ * 
+ * A node with refs set is also held elsewhere, like the body of a shell
+ * function; only one of its holders is dropped.
+ * 
+ * @param node The first node of the list, or NULL.
+ */
+void	node_free(t_node *node)
+{
+	t_node	*next;
+
+	while (node)
+	{
+		next = node->next;
+		if (node->refs-- > 0)
+		{
+			node = next;
+			continue ;
+		}
+		free(node->text);
+		if (node->words)
+			free_list(node->words);
+		if (node->body)
+			free_list(node->body);
+		free(node->redir);
+		node_free(node->cond);
+		node_free(node->list);
+		node_free(node->other);
+		free(node);
+		node = next;
+	}
+}
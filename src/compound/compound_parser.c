@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_parser.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:18:41 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:30:11 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Parses a simple command.
+ * 
+ * The command is not split here: its text is cut out of the source, up to
+ * the next separator, and goes through the usual lexer when it runs. A
+ * word that follows an alias ending in a blank is checked for an alias
+ * too. A reserved word out of place is a syntax error.
+ * 
+ * @param ctl The control parser.
+ * 
+ * @return The new node, or NULL on error.
+ */
+static t_node	*ctl_simple(t_ctl *ctl)
+{
+	int	start;
+
+	if (ctl_stop(ctl, CTL_RESERVED))
+	{
+		ctl_error(ctl);
+		return (NULL);
+	}
+	start = ctl->start;
+	while (ctl->type != CTL_EOF && ctl->type != CTL_NEWLINE
+		&& ctl->type != CTL_SEMI && ctl->type != CTL_DSEMI
+		&& ctl->type != CTL_PIPE)
+	{
+		ctl_next(ctl);
+		if (ctl->alias_next && ctl->start >= ctl->alias_next)
+			ctl_aliases(ctl);
+	}
+	return (node_simple(ctl, start, ctl->last_end));
+}
+
+/**
+ * @brief Parses the redirections that follow a compound command.
+ * 
+ * Their raw text is kept and only expanded and opened when the command
+ * runs, once for the whole command.
+ * 
+ * @param ctl The control parser.
+ * @param node The compound command.
+ */
+static void	ctl_redirs(t_ctl *ctl, t_node *node)
+{
+	int	start;
+	int	op;
+
+	start = ctl->start;
+	op = 0;
+	while (ctl->type == CTL_OP || (ctl->type == CTL_WORD && (op
+				|| (ft_isdigit(ctl->src[ctl->start]) && ctl->src[ctl->end]
+					&& ft_strchr("<>", ctl->src[ctl->end])))))
+	{
+		op = (ctl->type == CTL_OP);
+		ctl_next(ctl);
+	}
+	if (ctl->last_end > start)
+	{
+		node->redir = ft_substr(ctl->src, start, ctl->last_end - start);
+		if (!node->redir)
+			ctl->error = 1;
+	}
+}
+
+/**
+ * @brief Parses a single command of a pipeline.
+ * 
+ * Aliases are expanded first; one whose value is empty leaves an empty
+ * command.
+ * 
+ * @param ctl The control parser.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_command(t_ctl *ctl)
+{
+	t_node	*node;
+
+	node = NULL;
+	if (ctl_aliases(ctl) && ctl->type != CTL_WORD && ctl->type != CTL_OP)
+		node = node_simple(ctl, ctl->start, ctl->start);
+	else if (ctl->type != CTL_WORD && ctl->type != CTL_OP)
+		ctl_want(ctl, CTL_WORD);
+	else if (ctl->type == CTL_WORD && ctl_stop(ctl, CTL_COMPOUND))
+		node = ctl_compound(ctl);
+	else if (ctl_is_func(ctl))
+		node = ctl_function(ctl);
+	else
+		return (ctl_simple(ctl));
+	if (node)
+		ctl_redirs(ctl, node);
+	return (node);
+}
+
+/**
+ * @brief Builds the node of a pipeline of several commands.
+ * 
+ * A pipeline made of simple commands only stays a single simple command,
+ * run by the usual executor. One with a compound stage becomes a
+ * NODE_PIPE of its stages.
+ * 
+ * @param ctl The control parser.
+ * @param head The stages of the pipeline.
+ * @param start Where the pipeline starts in the source text.
+ * 
+ * @return The new node, or NULL on error.
+ */
+static t_node	*ctl_stages(t_ctl *ctl, t_node *head, int start)
+{
+	t_node	*node;
+
+	node = head;
+	while (node && node->type == NODE_SIMPLE)
+		node = node->next;
+	if (!node)
+	{
+		node_free(head);
+		return (node_simple(ctl, start, ctl->last_end));
+	}
+	node = node_new(ctl, NODE_PIPE);
+	if (!node)
+	{
+		node_free(head);
+		return (NULL);
+	}
+	node->list = head;
+	return (node);
+}
+
+/**
+ * @brief Parses a pipeline.
+ * 
+ * @param ctl The control parser.
+ * 
+ * @return The new node, or NULL on error.
+ */
+t_node	*ctl_pipeline(t_ctl *ctl)
+{
+	t_node	*head;
+	t_node	*node;
+	int		start;
+
+	if (ctl_is(ctl, "time"))
+		return (ctl_time(ctl));
+	head = NULL;
+	start = ctl->start;
+	node = ctl_command(ctl);
+	while (node)
+	{
+		node_append(&head, node);
+		if (ctl->type != CTL_PIPE)
+			break ;
+		ctl_next(ctl);
+		ctl_skip(ctl);
+		node = ctl_command(ctl);
+	}
+	if (!node || !head->next)
+	{
+		if (!node)
+			node_free(head);
+		return (node);
+	}
+	return (ctl_stages(ctl, head, start));
+}
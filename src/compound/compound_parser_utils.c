@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_parser_utils.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:18:31 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:28:44 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Reports a syntax error at the current token.
+ * 
+ * Only the first error is reported, and none once the input is known to
+ * be incomplete, since more lines may still fix it.
+ * 
+ * @param ctl The control parser.
+ */
+void	ctl_error(t_ctl *ctl)
+{
+	if (ctl->error || ctl->incomplete)
+		return ;
+	ctl->error = 1;
+	global_status()->nbr = 2;
+	ft_putstr_fd("minishell: syntax error near unexpected token '",
+		STDERR_FILENO);
+	if (ctl->type == CTL_NEWLINE || ctl->type == CTL_EOF)
+		ft_putstr_fd("newline", STDERR_FILENO);
+	else
+		write(STDERR_FILENO, ctl->src + ctl->start, ctl->end - ctl->start);
+	ft_putstr_fd("'\n", STDERR_FILENO);
+}
+
+/**
+ * @brief Checks that the current token has the given type.
+ * 
+ * @param ctl The control parser.
+ * @param type The expected token type.
+ * 
+ * @return 1 if it has, 0 after flagging the input as incomplete at the end
+ * of the text or reporting a syntax error otherwise.
+ */
+int	ctl_want(t_ctl *ctl, int type)
+{
+	if (ctl->type == type && !ctl->error && !ctl->incomplete)
+		return (1);
+	if (ctl->type == CTL_EOF && !ctl->error)
+		ctl->incomplete = 1;
+	else
+		ctl_error(ctl);
+	return (0);
+}
+
+/**
+ * @brief Consumes an expected reserved word.
+ * 
+ * @param ctl The control parser.
+ * @param word The reserved word.
+ * 
+ * @return 1 if the word was there, 0 otherwise.
+ */
+int	ctl_expect(t_ctl *ctl, char *word)
+{
+	if (ctl_is(ctl, word) && !ctl->error && !ctl->incomplete)
+	{
+		ctl_next(ctl);
+		return (1);
+	}
+	ctl_want(ctl, -1);
+	return (0);
+}
+
+/**
+ * @brief Skips empty lines.
+ * 
+ * @param ctl The control parser.
+ */
+void	ctl_skip(t_ctl *ctl)
+{
+	while (ctl->type == CTL_NEWLINE)
+		ctl_next(ctl);
+}
+
+/**
+ * @brief Tells whether a command list ends at the current token.
+ * 
+ * A list ends at the end of the text, at ";;", on error, or at one of the
+ * reserved words that may close it.
+ * 
+ * @param ctl The control parser.
+ * @param stops The reserved words closing the list, separated by spaces, or
+ * NULL.
+ * 
+ * @return 1 if the list ends here, 0 otherwise.
+ */
+int	ctl_stop(t_ctl *ctl, char *stops)
+{
+	int	len;
+	int	n;
+
+	if (ctl->type == CTL_EOF || ctl->type == CTL_DSEMI || ctl->error
+		|| ctl->incomplete)
+		return (1);
+	if (!stops || ctl->type != CTL_WORD)
+		return (0);
+	len = ctl->end - ctl->start;
+	while (*stops)
+	{
+		n = 0;
+		while (stops[n] && stops[n] != ' ')
+			n++;
+		if (n == len && !ft_strncmp(stops, ctl->src + ctl->start, n))
+			return (1);
+		stops += n + (stops[n] == ' ');
+	}
+	return (0);
+}
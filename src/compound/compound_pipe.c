@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_pipe.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:21:50 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:28:44 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Makes the current stdin and stdout the ones the shell goes back
+ * to after each command.
+ * 
+ * The previous copies are left open; callers that need them back save
+ * them first.
+ * 
+ * @param tools Pointer to the tools structure.
+ */
+void	std_rebase(t_tools *tools)
+{
+	tools->original_stdin = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC,
+			SAVED_FD_BASE);
+	tools->original_stdout = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC,
+			SAVED_FD_BASE);
+}
+
+/**
+ * @brief Runs one stage of a pipeline in the child process.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param stage The stage.
+ * @param in The read end of the previous pipe, or -1.
+ * @param fd The pipe to the next stage, or -1s for the last stage.
+ */
+static void	pipe_child(t_tools *tools, t_node *stage, int in, int *fd)
+{
+	if (in >= 0)
+	{
+		dup2(in, STDIN_FILENO);
+		close(in);
+	}
+	if (fd[1] >= 0)
+	{
+		dup2(fd[1], STDOUT_FILENO);
+		close(fd[1]);
+		close(fd[0]);
+	}
+	std_rebase(tools);
+	exec_node(tools, stage);
+	free_and_exit(tools, global_status()->nbr);
+}
+
+/**
+ * @brief Forks one stage of a pipeline.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param stage The stage.
+ * @param in The read end of the previous pipe, or -1. It is closed and
+ * replaced by the read end of the new pipe.
+ * 
+ * @return The pid of the stage, or -1 on error.
+ */
+static pid_t	pipe_fork(t_tools *tools, t_node *stage, int *in)
+{
+	int		fd[2];
+	pid_t	pid;
+
+	fd[0] = -1;
+	fd[1] = -1;
+	if (stage->next && pipe(fd) < 0)
+		return (-1);
+	pid = fork();
+	if (pid == 0)
+		pipe_child(tools, stage, *in, fd);
+	if (*in >= 0)
+		close(*in);
+	if (fd[1] >= 0)
+		close(fd[1]);
+	*in = fd[0];
+	return (pid);
+}
+
+/**
+ * @brief Waits for the stages of a pipeline.
+ * 
+ * @param pids The pids of the stages. They are freed.
+ * @param n The number of stages started.
+ * @param in The read end of the last pipe, if a stage failed to start.
+ */
+static void	pipe_wait(pid_t *pids, int n, int in)
+{
+	int	status;
+	int	i;
+
+	if (in >= 0)
+		close(in);
+	status = 0;
+	i = 0;
+	while (i < n)
+	{
+		if (pids[i] > 0)
+			waitpid(pids[i], &status, 0);
+		i++;
+	}
+	if (pids[n - 1] > 0)
+		get_status(&status);
+	else
+	{
+		perror("minishell");
+		global_status()->nbr = EXIT_FAILURE;
+	}
+	free(pids);
+}
+
+/**
+ * @brief Runs a pipeline with compound stages.
+ * 
+ * Every stage runs in its own child, connected to the next one by a pipe.
+ * The status is the one of the last stage.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The NODE_PIPE node.
+ */
+void	exec_pipe(t_tools *tools, t_node *node)
+{
+	t_node	*stage;
+	pid_t	*pids;
+	int		in;
+	int		n;
+
+	n = 0;
+	stage = node->list;
+	while (stage)
+	{
+		n++;
+		stage = stage->next;
+	}
+	pids = ft_calloc(n, sizeof(pid_t));
+	if (!pids)
+		return ;
+	read_sync();
+	in = -1;
+	n = 0;
+	stage = node->list;
+	while (stage && (n == 0 || pids[n - 1] > 0))
+	{
+		pids[n++] = pipe_fork(tools, stage, &in);
+		stage = stage->next;
+	}
+	pipe_wait(pids, n, in);
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_redir.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:21:29 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:13:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Turns the redirections of a compound command into a command.
+ * 
+ * They are parsed as the redirections of a ":" command, which gives them
+ * the expansion, here-document and error handling of any other command.
+ * The command line being run, if any, is preserved.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param redir The raw redirections.
+ * 
+ * @return The ":" command, or NULL on error.
+ */
+static t_parser	*redir_parse(t_tools *tools, char *redir)
+{
+	t_parser	*saved;
+	t_parser	*cmd;
+	char		*line;
+	int			pipes;
+
+	saved = tools->parser;
+	pipes = tools->pipes;
+	cmd = NULL;
+	line = ft_strjoin(": ", redir);
+	if (line && !lexer(lexer_split(line, 0), tools))
+		free_lexer(&tools->lexer);
+	else if (line && parser(tools))
+		cmd = tools->parser;
+	free_lexer(&tools->lexer);
+	free(line);
+	tools->parser = cmd;
+	if (cmd && !collect_heredocs(tools))
+		free_parser(&cmd);
+	tools->parser = saved;
+	tools->pipes = pipes;
+	return (cmd);
+}
+
+/**
+ * @brief Keeps the descriptors of a compound command open while it runs.
+ * 
+ * The commands inside close the descriptors they may have leaked once
+ * they are done, which must not include the explicit descriptors of the
+ * redirections nor the here-documents.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param cmd The redirections.
+ * @param saved The descriptors replaced by the redirections.
+ */
+static void	scope_keep(t_tools *tools, t_parser *cmd, t_saved_fds *saved)
+{
+	int	i;
+
+	i = 0;
+	while (i < saved->count)
+	{
+		if (saved->fd[i] > STDERR_FILENO && saved->fd[i] < MAX_FDS)
+			tools->exec_fds[saved->fd[i]] = 1;
+		i++;
+	}
+	i = 0;
+	while (cmd->heredocs && i < cmd->nb_heredocs)
+	{
+		if (cmd->heredocs[i] >= 0 && cmd->heredocs[i] < MAX_FDS)
+			tools->exec_fds[cmd->heredocs[i]] = 1;
+		i++;
+	}
+}
+
+/**
+ * @brief Applies the redirections of a compound command to the shell.
+ * 
+ * The redirected stdin and stdout become the ones the shell goes back to
+ * after each command inside, until scope_leave().
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param cmd The redirections.
+ * @param scope Where the state of the shell is saved.
+ */
+static void	scope_enter(t_tools *tools, t_parser *cmd, t_scope *scope)
+{
+	read_sync();
+	save_redirected_fds(cmd, &scope->fds);
+	redirection(cmd);
+	scope->std[0] = tools->original_stdin;
+	scope->std[1] = tools->original_stdout;
+	ft_memcpy(scope->exec_fds, tools->exec_fds, MAX_FDS);
+	std_rebase(tools);
+	scope_keep(tools, cmd, &scope->fds);
+}
+
+/**
+ * @brief Goes back to the state saved by scope_enter().
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param scope The saved state.
+ */
+static void	scope_leave(t_tools *tools, t_scope *scope)
+{
+	read_sync();
+	if (tools->original_stdin >= 0)
+		close(tools->original_stdin);
+	if (tools->original_stdout >= 0)
+		close(tools->original_stdout);
+	tools->original_stdin = scope->std[0];
+	tools->original_stdout = scope->std[1];
+	ft_memcpy(tools->exec_fds, scope->exec_fds, MAX_FDS);
+	restore_fds(&scope->fds);
+}
+
+/**
+ * @brief Runs a compound command with its redirections.
+ * 
+ * The files are opened once and stay open for the whole command, so
+ * "done > out" collects the output of every pass of a loop. If a
+ * redirection fails, the command does not run. Process substitutions in
+ * the redirections last as long.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The compound command.
+ */
+void	exec_redirected(t_tools *tools, t_node *node)
+{
+	t_parser	*cmd;
+	t_scope		scope;
+	int			mark;
+
+	mark = proc_substs()->count;
+	cmd = redir_parse(tools, node->redir);
+	if (cmd)
+	{
+		scope_enter(tools, cmd, &scope);
+		if (cmd->str)
+			exec_compound(tools, node);
+		scope_leave(tools, &scope);
+		free_parser(&cmd);
+	}
+	procsub_end(tools, mark);
+}
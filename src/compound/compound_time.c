@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_time.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:28:38 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:28:38 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Parses a pipeline preceded by the time reserved word.
+ * 
+ * "time [-p] pipeline" times a single pipeline, wherever it appears in a
+ * list. With nothing after it, an empty command is timed.
+ * 
+ * @param ctl The control parser, on the time keyword.
+ * 
+ * @return The NODE_TIME node, its pipeline in list and "-p" in text when
+ * the POSIX format is asked for, or NULL on error.
+ */
+t_node	*ctl_time(t_ctl *ctl)
+{
+	t_node	*node;
+
+	node = node_new(ctl, NODE_TIME);
+	if (!node)
+		return (NULL);
+	ctl_next(ctl);
+	if (ctl_is(ctl, "-p"))
+	{
+		node->text = ctl_text(ctl);
+		ctl->error |= (node->text == NULL);
+		ctl_next(ctl);
+	}
+	if (ctl->type == CTL_EOF || ctl->type == CTL_NEWLINE
+		|| ctl->type == CTL_SEMI)
+		node->list = node_simple(ctl, ctl->start, ctl->start);
+	else
+		node->list = ctl_pipeline(ctl);
+	if (!node->list)
+	{
+		node_free(node);
+		return (NULL);
+	}
+	return (node);
+}
+
+/**
+ * @brief Runs a timed pipeline and prints its timing report.
+ * 
+ * The timer of an enclosing timed command, like one calling a function
+ * that times its own commands, is put back afterwards and keeps the
+ * highest peak memory usage seen.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The NODE_TIME node.
+ */
+void	exec_time(t_tools *tools, t_node *node)
+{
+	t_timer	saved;
+
+	saved = tools->timer;
+	tools->timer.posix = (node->text != NULL);
+	time_start(&tools->timer);
+	exec_node(tools, node->list);
+	time_report(tools);
+	if (tools->timer.maxrss > saved.maxrss)
+		saved.maxrss = tools->timer.maxrss;
+	tools->timer = saved;
+}
@@ -0,0 +1,162 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   compound_words.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:20:54 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:48:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Expands a text into a list of words, the way a command line is.
+ * 
+ * Variables are expanded and unquoted results are split, then the quotes
+ * are removed. The lexer of the command being run, if any, is preserved.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param text The raw text, or NULL.
+ * 
+ * @return The words, or NULL on allocation error.
+ */
+char	**expand_words(t_tools *tools, char *text)
+{
+	t_lexer	*saved;
+	t_lexer	*current;
+	char	**words;
+	int		pipes;
+
+	saved = tools->lexer;
+	pipes = tools->pipes;
+	words = ft_calloc(1, sizeof(char *));
+	if (words && text && lexer(lexer_split(text, 0), tools))
+	{
+		current = tools->lexer;
+		while (words && current)
+		{
+			if (current->words)
+				words = list_add(words, ft_strdup(current->words));
+			current = current->next;
+		}
+	}
+	if (tools->lexer)
+		free_lexer(&tools->lexer);
+	tools->lexer = saved;
+	tools->pipes = pipes;
+	return (words);
+}
+
+/**
+ * @brief Joins a list of words with single spaces.
+ * 
+ * @param words The words.
+ * 
+ * @return The joined text, or NULL on allocation error.
+ */
+static char	*join_words(char **words)
+{
+	char	*text;
+	int		i;
+
+	text = ft_strdup("");
+	i = 0;
+	while (text && words[i])
+	{
+		text = append_len(text, " ", i > 0);
+		if (text)
+			text = append_len(text, words[i], ft_strlen(words[i]));
+		i++;
+	}
+	return (text);
+}
+
+/**
+ * @brief Expands the words of a for loop.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param raw The raw words after "in", or NULL to use the positional
+ * parameters.
+ * 
+ * @return The words to loop over, or NULL on allocation error.
+ */
+char	**for_words(t_tools *tools, char **raw)
+{
+	char	**words;
+	char	*text;
+
+	if (raw)
+		text = join_words(raw);
+	else
+		text = ft_strdup("$@");
+	words = expand_words(tools, text);
+	free(text);
+	return (words);
+}
+
+/**
+ * @brief Expands a raw word into a single string.
+ * 
+ * Filename expansion does not apply to a single word.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param raw The raw word, or NULL.
+ * 
+ * @return The expansion, split parts joined by spaces, or NULL on error.
+ */
+char	*expand_word(t_tools *tools, char *raw)
+{
+	char	**words;
+	char	*text;
+	int		disabled;
+
+	if (!raw)
+		return (NULL);
+	disabled = glob_options()->disabled;
+	glob_options()->disabled = 1;
+	words = expand_words(tools, raw);
+	glob_options()->disabled = disabled;
+	if (!words)
+		return (NULL);
+	text = join_words(words);
+	free_list(words);
+	return (text);
+}
+
+/**
+ * @brief Protects the quoted characters of a case pattern.
+ * 
+ * Pattern characters between quotes are backslash-escaped, so they keep
+ * matching literally once the quotes are removed by the expansion.
+ * 
+ * @param raw The raw pattern.
+ * 
+ * @return The escaped pattern, or NULL on allocation error.
+ */
+char	*case_pattern(char *raw)
+{
+	char	*pattern;
+	char	quote;
+	int		n;
+
+	pattern = malloc(ft_strlen(raw) * 2 + 1);
+	if (!pattern)
+		return (NULL);
+	quote = 0;
+	n = 0;
+	while (*raw)
+	{
+		if (!quote && (*raw == '\'' || *raw == '"'))
+			quote = *raw;
+		else if (quote && *raw == quote)
+			quote = 0;
+		else if (quote && ft_strchr("*?[]\\", *raw))
+			pattern[n++] = '\\';
+		pattern[n++] = *raw++;
+	}
+	pattern[n] = '\0';
+	return (pattern);
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cond.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:41:27 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:45:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/cond.h"
+
+/**
+ * @brief Reports a syntax error in a conditional expression.
+ * 
+ * Only the first error is printed; the command then has status 2.
+ * 
+ * @param cond The expression being evaluated.
+ * @param word The offending word, or NULL at the end of the expression.
+ * 
+ * @return 0, so callers can return it as the result of the expression.
+ */
+int	cond_err(t_cond *cond, char *word)
+{
+	if (!cond->error)
+	{
+		ft_putstr_fd("minishell: syntax error in conditional expression",
+			STDERR_FILENO);
+		if (word)
+		{
+			ft_putstr_fd(": unexpected token `", STDERR_FILENO);
+			ft_putstr_fd(word, STDERR_FILENO);
+			ft_putstr_fd("'", STDERR_FILENO);
+		}
+		ft_putstr_fd("\n", STDERR_FILENO);
+	}
+	cond->error = 1;
+	return (0);
+}
+
+/**
+ * @brief Evaluates a term: "! term", "( expression )" or a primary.
+ * 
+ * @param cond The expression being evaluated.
+ * @param run 1 to evaluate, 0 to only skip the term, without expanding
+ * anything, as "&&" and "||" do with the operand they do not need.
+ * 
+ * @return The truth value of the term.
+ */
+int	cond_term(t_cond *cond, int run)
+{
+	int	result;
+
+	if (cond->pos >= cond->count)
+		return (cond_err(cond, NULL));
+	if (ft_strcmp(cond->words[cond->pos], "!") == 0)
+	{
+		cond->pos++;
+		return (!cond_term(cond, run));
+	}
+	if (ft_strcmp(cond->words[cond->pos], "(") == 0)
+	{
+		cond->pos++;
+		result = cond_or(cond, run);
+		if (cond->pos >= cond->count
+			|| ft_strcmp(cond->words[cond->pos], ")"))
+			return (cond_err(cond, NULL));
+		cond->pos++;
+		return (result);
+	}
+	return (cond_primary(cond, run));
+}
+
+/**
+ * @brief Evaluates terms joined by "&&".
+ * 
+ * @param cond The expression being evaluated.
+ * @param run 1 to evaluate, 0 to only skip the terms.
+ * 
+ * @return The truth value of the conjunction.
+ */
+int	cond_and(t_cond *cond, int run)
+{
+	int	result;
+	int	next;
+
+	result = cond_term(cond, run);
+	while (!cond->error && cond->pos < cond->count
+		&& ft_strcmp(cond->words[cond->pos], "&&") == 0)
+	{
+		cond->pos++;
+		next = cond_term(cond, run && result);
+		result = result && next;
+	}
+	return (result);
+}
+
+/**
+ * @brief Evaluates conjunctions joined by "||".
+ * 
+ * @param cond The expression being evaluated.
+ * @param run 1 to evaluate, 0 to only skip the conjunctions.
+ * 
+ * @return The truth value of the expression.
+ */
+int	cond_or(t_cond *cond, int run)
+{
+	int	result;
+	int	next;
+
+	result = cond_and(cond, run);
+	while (!cond->error && cond->pos < cond->count
+		&& ft_strcmp(cond->words[cond->pos], "||") == 0)
+	{
+		cond->pos++;
+		next = cond_and(cond, run && !result);
+		result = result || next;
+	}
+	return (result);
+}
+
+/**
+ * @brief Runs a "[[ expression ]]" conditional command.
+ * 
+ * The expression is evaluated in the shell process, and its operands are
+ * expanded without word splitting or globbing.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param node The conditional command.
+ */
+void	exec_cond(t_tools *tools, t_node *node)
+{
+	t_cond	cond;
+	int		result;
+
+	cond = (t_cond){tools, node->words, count_lines(node->words), 0, 0};
+	result = cond_or(&cond, 1);
+	if (!cond.error && cond.pos < cond.count)
+		cond_err(&cond, cond.words[cond.pos]);
+	global_status()->nbr = !result;
+	if (cond.error)
+		global_status()->nbr = 2;
+}
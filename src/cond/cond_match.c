@@ -0,0 +1,181 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cond_match.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:42:46 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:45:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/cond.h"
+
+/**
+ * @brief Copies one character of a raw regular expression, protecting it
+ * as needed.
+ * 
+ * A quoted character matches itself, so it gets a backslash if it means
+ * something to a regular expression. An unquoted backslash keeps its
+ * meaning for the regular expression, and so do the unquoted operator
+ * characters: they are put in single quotes, which survive the expansion.
+ * 
+ * @param out The pattern being built.
+ * @param n The length of out, updated.
+ * @param raw The raw text, on the character.
+ * @param quote The quote the character is in, or 0.
+ * 
+ * @return The number of raw characters used.
+ */
+static int	regex_escape(char *out, int *n, char *raw, char quote)
+{
+	int	len;
+	int	wrap;
+
+	len = 1 + (quote != '\'' && raw[0] == '\\' && raw[1]);
+	wrap = (!quote && ((len == 2 && ft_strchr(REGEX_SPECIAL, raw[1]))
+				|| ft_strchr("|&;<>", raw[0])));
+	if (quote && len == 1 && ft_strchr(REGEX_SPECIAL, raw[0])
+		&& (quote == '\'' || !ft_strchr("$\\", raw[0])))
+		out[(*n)++] = '\\';
+	if (wrap)
+		out[(*n)++] = '\'';
+	ft_memcpy(out + *n, raw, len);
+	*n += len;
+	if (wrap)
+		out[(*n)++] = '\'';
+	return (len);
+}
+
+/**
+ * @brief Protects the quoted characters of a raw regular expression.
+ * 
+ * Works like case_pattern() does for the patterns of a case command.
+ * 
+ * @param raw The raw regular expression.
+ * 
+ * @return The protected text, still to expand, or NULL on allocation
+ * error.
+ */
+static char	*regex_pattern(char *raw)
+{
+	char	*pattern;
+	char	quote;
+	int		n;
+
+	pattern = malloc(ft_strlen(raw) * 3 + 1);
+	if (!pattern)
+		return (NULL);
+	quote = 0;
+	n = 0;
+	while (*raw)
+	{
+		if ((!quote && (*raw == '\'' || *raw == '"')) || *raw == quote)
+		{
+			quote ^= *raw;
+			pattern[n++] = *raw++;
+		}
+		else
+			raw += regex_escape(pattern, &n, raw, quote);
+	}
+	pattern[n] = '\0';
+	return (pattern);
+}
+
+/**
+ * @brief Stores the result of a "=~" test in the BASH_REMATCH array.
+ * 
+ * Element 0 is the part of the string that matched, and the others what
+ * the groups of the expression matched. A failed test leaves it empty.
+ * 
+ * @param s The string tested.
+ * @param match The match offsets.
+ * @param count The number of offsets, 0 if the test failed.
+ */
+static void	regex_rematch(char *s, regmatch_t *match, size_t count)
+{
+	t_array	*array;
+	size_t	i;
+
+	array = array_new("BASH_REMATCH", 0);
+	i = 0;
+	while (array && i < count)
+	{
+		if (match[i].rm_so < 0)
+			array_put(array, i, ft_strdup(""));
+		else
+			array_put(array, i, ft_substr(s, match[i].rm_so,
+					match[i].rm_eo - match[i].rm_so));
+		i++;
+	}
+}
+
+/**
+ * @brief Evaluates "==", "=" and "!=", whose right operand is a pattern.
+ * 
+ * @param cond The expression being evaluated.
+ * @param s The expanded left operand.
+ * @param op The operator.
+ * @param raw The raw pattern.
+ * 
+ * @return The truth value of the operator.
+ */
+int	cond_pattern(t_cond *cond, char *s, char *op, char *raw)
+{
+	char	*text;
+	char	*pattern;
+	int		result;
+
+	text = case_pattern(raw);
+	pattern = NULL;
+	if (text)
+		pattern = cond_expand(cond, text);
+	cond->error |= (!text);
+	free(text);
+	result = (pattern && match_pattern(pattern, s) == (op[0] != '!'));
+	free(pattern);
+	return (result);
+}
+
+/**
+ * @brief Evaluates "=~", whose right operand is an extended regular
+ * expression.
+ * 
+ * The compiled expression comes from the regular expression cache. An
+ * invalid one makes the command fail with status 2.
+ * 
+ * @param cond The expression being evaluated.
+ * @param s The expanded left operand.
+ * @param raw The raw regular expression.
+ * 
+ * @return 1 if the string matches, 0 otherwise.
+ */
+int	cond_regex(t_cond *cond, char *s, char *raw)
+{
+	char		*text;
+	char		*pattern;
+	regex_t		*re;
+	regmatch_t	*match;
+	int			result;
+
+	text = regex_pattern(raw);
+	pattern = NULL;
+	if (text)
+		pattern = cond_expand(cond, text);
+	free(text);
+	re = NULL;
+	if (pattern)
+		re = regex_get(pattern);
+	free(pattern);
+	if (!re)
+	{
+		cond->error = 1;
+		return (0);
+	}
+	match = malloc((re->re_nsub + 1) * sizeof(regmatch_t));
+	result = (match && !regexec(re, s, re->re_nsub + 1, match, 0));
+	regex_rematch(s, match, (re->re_nsub + 1) * result);
+	free(match);
+	return (result);
+}
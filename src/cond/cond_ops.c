@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cond_ops.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:41:34 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:45:10 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/cond.h"
+
+/**
+ * @brief Expands an operand of a conditional expression.
+ * 
+ * @param cond The expression being evaluated.
+ * @param raw The raw operand.
+ * 
+ * @return The newly allocated operand, or NULL on error, which makes the
+ * command fail with status 2.
+ */
+char	*cond_expand(t_cond *cond, char *raw)
+{
+	char	*word;
+
+	word = expand_word(cond->tools, raw);
+	if (!word)
+		cond->error = 1;
+	return (word);
+}
+
+/**
+ * @brief Evaluates an integer or a file comparison.
+ * 
+ * The operands of -eq, -ne, -lt, -le, -gt and -ge are arithmetic
+ * expressions. The other operators are those of test.
+ * 
+ * @param cond The expression being evaluated.
+ * @param a The first operand.
+ * @param op The operator.
+ * @param b The second operand.
+ * 
+ * @return The truth value of the comparison.
+ */
+static int	cond_compare(t_cond *cond, char *a, char *op, char *b)
+{
+	long long	x;
+	long long	y;
+	t_test		test;
+
+	if (op[0] != '-' || !ft_strcmp(op, "-nt") || !ft_strcmp(op, "-ot")
+		|| !ft_strcmp(op, "-ef"))
+	{
+		test = (t_test){"[[", (char *[]){a, op, b}, 3, 0, 0};
+		return (test_binary(&test));
+	}
+	if (!arith_eval(cond->tools, a, 0, &x)
+		|| !arith_eval(cond->tools, b, 0, &y))
+	{
+		cond->error = 1;
+		return (0);
+	}
+	if (!ft_strcmp(op, "-eq") || !ft_strcmp(op, "-ne"))
+		return ((x == y) == (op[1] == 'e'));
+	if (!ft_strcmp(op, "-lt") || !ft_strcmp(op, "-ge"))
+		return ((x < y) == (op[1] == 'l'));
+	return ((x > y) == (op[1] == 'g'));
+}
+
+/**
+ * @brief Evaluates a binary operator and its two operands.
+ * 
+ * The right operand of "==", "=" and "!=" is a pattern, and that of "=~"
+ * a regular expression.
+ * 
+ * @param cond The expression being evaluated, on the first operand.
+ * @param run 1 to evaluate, 0 to only skip the operator.
+ * 
+ * @return The truth value of the operator.
+ */
+static int	cond_binary(t_cond *cond, int run)
+{
+	char	**w;
+	char	*a;
+	char	*b;
+	int		result;
+
+	w = cond->words + cond->pos;
+	cond->pos += 3;
+	a = NULL;
+	if (run)
+		a = cond_expand(cond, w[0]);
+	result = 0;
+	if (a && (!ft_strcmp(w[1], "==") || !ft_strcmp(w[1], "=")
+			|| !ft_strcmp(w[1], "!=")))
+		result = cond_pattern(cond, a, w[1], w[2]);
+	else if (a && !ft_strcmp(w[1], "=~"))
+		result = cond_regex(cond, a, w[2]);
+	else if (a)
+	{
+		b = cond_expand(cond, w[2]);
+		result = (b && cond_compare(cond, a, w[1], b));
+		free(b);
+	}
+	free(a);
+	return (result);
+}
+
+/**
+ * @brief Evaluates a primary: a binary operator and its operands, a
+ * unary operator and its operand, or a single string that is true when
+ * it is not empty.
+ * 
+ * @param cond The expression being evaluated.
+ * @param run 1 to evaluate, 0 to only skip the primary.
+ * 
+ * @return The truth value of the primary.
+ */
+int	cond_primary(t_cond *cond, int run)
+{
+	char	**w;
+	char	*arg;
+	int		unary;
+	int		result;
+	t_test	test;
+
+	w = cond->words + cond->pos;
+	if (w[1] && (is_test_binary(w[1]) || !ft_strcmp(w[1], "=~")))
+	{
+		if (!w[2])
+			return (cond_err(cond, NULL));
+		return (cond_binary(cond, run));
+	}
+	unary = (w[0][0] == '-' && w[0][1] && !w[0][2] && w[1]
+			&& ft_strchr(TEST_UNARY, w[0][1]));
+	cond->pos += 1 + unary;
+	arg = NULL;
+	if (run)
+		arg = cond_expand(cond, w[unary]);
+	test = (t_test){"[[", (char *[]){w[0], arg}, 2, 0, 0};
+	result = (arg && unary && test_primary(&test));
+	result |= (arg && !unary && arg[0]);
+	cond->error |= test.error;
+	free(arg);
+	return (result);
+}
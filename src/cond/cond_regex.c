@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cond_regex.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:42:01 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:45:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/cond.h"
+
+/**
+ * @brief Returns the cache of compiled regular expressions.
+ * 
+ * The entries are kept from the most to the least recently used, and are
+ * keyed by the text of their pattern. A "=~" test in a loop compiles its
+ * pattern once, and the cache never holds more than REGEX_CACHE_SIZE
+ * entries.
+ * 
+ * @return Pointer to the cache. It lives for the whole run of the shell.
+ */
+static t_regcache	*regex_cache(void)
+{
+	static t_regcache	cache;
+
+	return (&cache);
+}
+
+/**
+ * @brief Frees an entry of the cache.
+ * 
+ * @param entry The entry.
+ */
+static void	regex_free(t_regentry *entry)
+{
+	regfree(entry->re);
+	free(entry->re);
+	free(entry->pattern);
+}
+
+/**
+ * @brief Empties the cache of compiled regular expressions.
+ */
+void	regex_cache_clear(void)
+{
+	t_regcache	*cache;
+
+	cache = regex_cache();
+	while (cache->count > 0)
+		regex_free(&cache->entries[--cache->count]);
+}
+
+/**
+ * @brief Compiles a pattern into a new entry at the front of the cache.
+ * 
+ * The least recently used entry makes room for it when the cache is full.
+ * 
+ * @param cache The cache.
+ * @param pattern The pattern.
+ * 
+ * @return The compiled expression, or NULL if the pattern is invalid or
+ * memory ran out.
+ */
+static regex_t	*regex_compile(t_regcache *cache, char *pattern)
+{
+	t_regentry	entry;
+
+	entry.pattern = ft_strdup(pattern);
+	entry.re = malloc(sizeof(regex_t));
+	if (!entry.pattern || !entry.re || regcomp(entry.re, pattern,
+			REG_EXTENDED))
+	{
+		free(entry.pattern);
+		free(entry.re);
+		return (NULL);
+	}
+	if (cache->count == REGEX_CACHE_SIZE)
+		regex_free(&cache->entries[--cache->count]);
+	ft_memmove(cache->entries + 1, cache->entries,
+		cache->count * sizeof(t_regentry));
+	cache->entries[0] = entry;
+	cache->count++;
+	return (entry.re);
+}
+
+/**
+ * @brief Returns the compiled form of a regular expression.
+ * 
+ * A pattern found in the cache moves to its front; any other is compiled
+ * and added.
+ * 
+ * @param pattern The extended regular expression.
+ * 
+ * @return The compiled expression, which belongs to the cache, or NULL
+ * if the pattern is invalid or memory ran out.
+ */
+regex_t	*regex_get(char *pattern)
+{
+	t_regcache	*cache;
+	t_regentry	entry;
+	int			i;
+
+	cache = regex_cache();
+	i = 0;
+	while (i < cache->count && ft_strcmp(cache->entries[i].pattern, pattern))
+		i++;
+	if (i == cache->count)
+		return (regex_compile(cache, pattern));
+	entry = cache->entries[i];
+	ft_memmove(cache->entries + 1, cache->entries, i * sizeof(t_regentry));
+	cache->entries[0] = entry;
+	return (entry.re);
+}
@@ -6,7 +6,7 @@
 /*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/27 17:49:27 by ftomaz-c         ###   ########.fr       */
+/*   Updated: 2026/10/19 00:28:44 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -41,10 +41,10 @@ void	here_doc_handler(int sig)
 {
 	if (sig == SIGINT)
 	{
-		rl_clear_history();
 		rl_replace_line("", 0);
 		rl_on_new_line();
 		global_status()->nbr = 130;
+		global_status()->sigint = 1;
 		close(STDIN_FILENO);
 	}
 }
@@ -52,13 +52,19 @@ void	here_doc_handler(int sig)
 /**
  * @brief Signal handler for child processes, handles SIGINT and SIGQUIT.
  * 
+ * SIGINT is also recorded in global_status()->sigint, which stops the
+ * control structures being run, whatever the status of their commands.
+ * 
  * @param sig The signal number received.
  */
 void	child_handler(int sig)
 {
 	rl_on_new_line();
 	if (sig == SIGINT)
+	{
 		global_status()->nbr = 130;
+		global_status()->sigint = 1;
+	}
 	else if (sig == SIGQUIT)
 		global_status()->nbr = 131;
 }
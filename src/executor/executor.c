@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 18:57:29 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,9 +26,11 @@ void	exec_path(t_tools *tools, char **cmd_args, char **envp)
 	char	*cmd_path;
 	char	*tmp;
 	int		i;
+	int		indexed;
 
 	i = 0;
-	while (tools->path[i] && cmd_args[0] && cmd_args[0][0] != '.')
+	indexed = exec_indexed(tools, cmd_args, envp);
+	while (!indexed && tools->path[i] && cmd_args[0] && cmd_args[0][0] != '.')
 	{
 		tmp = ft_strjoin(tools->path[i], "/");
 		cmd_path = ft_strjoin(tmp, cmd_args[0]);
@@ -50,28 +52,24 @@ void	exec_path(t_tools *tools, char **cmd_args, char **envp)
  * If the command is a builtin command (like echo or env),
  *  it executes it directly.
  * If the command is an external command, it executes it
- *  using exec_path function.
+ *  using exec_path function, with its prefix assignments in its
+ *  environment.
  * 
  * @param tools  Pointer to the tools struct containing
  *  necessary information.
  * @param parser Pointer to the parser struct containing
  * the command information.
  */
-void	execute_cmd(t_tools *tools, t_parser *parser, int index)
+void	execute_cmd(t_tools *tools, t_parser *parser)
 {
-	if (parser->builtin && (parser->builtin == cmd_echo
-			|| parser->builtin == cmd_env || parser->builtin == cmd_cd
-			|| parser->builtin == cmd_pwd || parser->builtin == cmd_export
-			|| parser->builtin == cmd_unset || parser->builtin == cmd_exit
-			|| parser->builtin == cmd_history))
+	if (parser->builtin)
 	{
-		broadcast_signal(tools, index, SIGSTOP);
-		parser->builtin(tools, parser);
-		broadcast_signal(tools, index, SIGCONT);
+		run_builtin(tools, parser);
 		free_and_exit(tools, global_status()->nbr);
 	}
 	else if (!parser->builtin)
 	{
+		prefix_apply(tools, parser);
 		if (!is_executable(tools, parser->str, tools->env))
 			return ;
 		exec_path(tools, parser->str, tools->env);
@@ -86,6 +84,8 @@ void	execute_cmd(t_tools *tools, t_parser *parser, int index)
  * This function configures redirections and sets up 
  * standard input and output.
  * If redirections are present, it calls the redirection function.
+ * A stage whose redirection fails is skipped; if it is the last one, its
+ * status becomes the status of the pipeline.
  * 
  * @param parser The parser containing command and 
  * redirection information.
@@ -94,36 +94,37 @@ void	set_and_execute(t_tools *tools, t_parser *parser)
 {
 	int	index;
 	int	status;
+	int	failed;
 
 	index = 0;
 	status = 0;
+	failed = 0;
 	while (parser)
 	{
 		if (parser->prev && parser->prev->stdout_flag)
 			dup2(tools->original_stdout, STDOUT_FILENO);
 		if (parser->redirections != NULL)
-		{
-			redirection(tools, parser, &index);
-			if (!parser->str)
-			{
-				parser = parser->next;
-				continue ;
-			}
-		}
-		minishell_pipex(tools, parser, &index);
+			redirection(parser);
+		if (parser->str)
+			minishell_pipex(tools, parser, &index);
+		if (parser->str)
+			index++;
+		else if (!parser->next)
+			failed = global_status()->nbr;
 		parser = parser->next;
-		index++;
 	}
 	child_waitpid(tools, &status);
+	if (failed)
+		global_status()->nbr = failed;
 }
 
 /**
- * @brief Executes simple commands and builtins if no pipes or redirections are
- * present.
+ * @brief Executes simple commands and builtins if no pipes are present.
  * 
- * This function checks if there are no pipes and no redirections in the command.
+ * This function checks if there are no pipes in the command.
  * If the command is a valid simple command or a builtin command, it executes
- * the command.
+ * the command. Builtins with redirections also run in the shell process,
+ * with their descriptors saved and restored around the call.
  * 
  * @param tools  Pointer to the tools struct containing necessary information.
  * @param parser Pointer to the parser struct containing the command information.
@@ -144,16 +145,17 @@ int	simple_exec_and_buitlins(t_tools *tools, t_parser *parser)
 		if (parser->str[0] && (parser->str[0][0] == '/'
 			|| (ft_strncmp("./", parser->str[0], 2) == 0)) && !parser->str[1])
 			parser->builtin = cmd_cd;
-		if (parser->builtin && (parser->builtin == cmd_echo
-				|| parser->builtin == cmd_env || parser->builtin == cmd_cd
-				|| parser->builtin == cmd_pwd || parser->builtin == cmd_export
-				|| parser->builtin == cmd_unset || parser->builtin == cmd_exit
-				|| parser->builtin == cmd_history))
+		if (parser->builtin)
 		{
-			parser->builtin(tools, parser);
+			run_builtin(tools, parser);
 			return (1);
 		}
 	}
+	else if (!tools->pipes && parser->str[0] && parser->builtin)
+	{
+		run_builtin_redirected(tools, parser);
+		return (1);
+	}
 	return (0);
 }
 
@@ -179,8 +181,12 @@ int	executor(t_tools *tools)
 
 	handle_child_sigaction();
 	parser = tools->parser;
-	if (simple_exec_and_buitlins(tools, parser))
+	if (!collect_heredocs(tools))
+		return (global_status()->nbr);
+	if (simple_exec_and_buitlins(tools, parser)
+		|| command_not_found(tools, parser))
 		return (global_status()->nbr);
+	read_sync();
 	pid = fork();
 	if (pid < 0)
 		exit(EXIT_FAILURE);
@@ -6,32 +6,32 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/27 15:34:40 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/18 23:54:39 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../includes/executor.h"
 
 /**
- * @brief Sends a specified signal to multiple processes.
+ * @brief Gets the status of a terminated process and updates the global status.
  * 
- * This function iterates through the process IDs stored in tools->pids
- * and sends the specified signal to each process.
- * 
- * @param tools   A pointer to the tools structure containing process IDs.
- * @param num_pids The number of process IDs to which the signal should be sent.
- * @param signal  The signal to be sent to the processes.
+ * @param status Pointer to the status variable containing the termination
+ * status of the process.
  */
-void	broadcast_signal(t_tools *tools, int num_pids, int signal)
+void	get_status(int *status)
 {
-	int			i;
+	int	sig;
 
-	i = 0;
-	while (i < num_pids)
+	if (WIFSIGNALED(*status))
 	{
-		kill (tools->pids[i], signal);
-		i++;
+		sig = WTERMSIG(*status);
+		if (sig == SIGINT)
+			global_status()->nbr = 130;
+		else if (sig == SIGQUIT)
+			global_status()->nbr = 131;
 	}
+	else if (WIFEXITED(*status))
+		global_status()->nbr = WEXITSTATUS(*status);
 }
 
 /**
@@ -108,13 +108,9 @@ void	exec_err(t_tools *tools, int err, char *str)
  */
 void	wait_status(t_tools *tools, int pid, int *status)
 {
-	int	i;
-
-	waitpid(pid, status, 0);
+	wait_usage(tools, pid, status);
 	get_status(status);
-	i = 3;
-	while (i < 1024)
-		close(i++);
+	close_fds(tools);
 	if (global_status()->nbr == 130)
 		ft_putstr_fd("\n", STDOUT_FILENO);
 	else if (global_status()->nbr == 131)
@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/25 11:46:35 by ftomazc           #+#    #+#             */
-/*   Updated: 2024/05/27 23:18:13 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,8 +19,12 @@ void	child_waitpid(t_tools *tools, int *status)
 	i = 0;
 	while (i < tools->pipes + 1)
 	{
-		waitpid (tools->pids[i++], status, 0);
-		get_status(status);
+		if (tools->pids[i])
+		{
+			waitpid (tools->pids[i], status, 0);
+			get_status(status);
+		}
+		i++;
 	}
 }
 
@@ -32,20 +36,26 @@ void	child_waitpid(t_tools *tools, int *status)
  * and other necessary data.
  * @param parser Pointer to the parser structure containing the command string
  * to be executed.
+ * @param env The environment, to which the child adds the prefix assignments
+ * of the command.
  */
 void	execute_simple_cmd(t_tools *tools, t_parser *parser, char **env)
 {
 	pid_t	pid;
 	int		status;
 
+	read_sync();
 	pid = fork();
 	if (pid < 0)
 		perror("minishell: ");
 	else if (pid == 0)
+	{
+		env = prefix_apply(tools, parser);
 		exec_path(tools, parser->str, env);
+	}
 	else
 	{
-		waitpid(pid, &status, 0);
+		wait_usage(tools, pid, &status);
 		if (WIFEXITED(status))
 			global_status()->nbr = WEXITSTATUS(status);
 	}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_utils3.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:50:30 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:49:30 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+
+/**
+ * @brief Executes a command through the PATH index.
+ * 
+ * When the index knows where the command is, it is executed straight away;
+ * when it knows the command is on no PATH directory, the search of PATH
+ * can be skipped altogether.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param cmd_args The command arguments.
+ * @param envp The environment variables.
+ * 
+ * @return 1 if the command is known not to be on PATH (errno is ENOENT),
+ * 0 if PATH still has to be searched.
+ */
+int	exec_indexed(t_tools *tools, char **cmd_args, char **envp)
+{
+	char	*cmd_path;
+	int		found;
+
+	if (!cmd_args[0] || cmd_args[0][0] == '.' || ft_strchr(cmd_args[0], '/'))
+		return (0);
+	cmd_path = NULL;
+	found = path_index_find(tools->path, cmd_args[0], &cmd_path);
+	if (found == 1)
+		execve(cmd_path, cmd_args, envp);
+	free(cmd_path);
+	if (found != 0)
+		return (0);
+	errno = ENOENT;
+	return (1);
+}
+
+/**
+ * @brief Reports an unknown command without forking.
+ * 
+ * A simple command with no redirections whose name is on no PATH directory
+ * gets its "command not found" straight from the shell process. One with
+ * prefix assignments may change PATH, so it is left to its child.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param parser The command.
+ * 
+ * @return 1 if the command was handled here, 0 if it must be executed.
+ */
+int	command_not_found(t_tools *tools, t_parser *parser)
+{
+	char	*cmd_path;
+	int		found;
+
+	path_index_update(tools->path);
+	if (tools->pipes || parser->nb_redirections || parser->builtin
+		|| parser->assigns || !parser->str || !parser->str[0]
+		|| parser->str[0][0] == '.' || ft_strchr(parser->str[0], '/'))
+		return (0);
+	if (!tools->nint_mode && access(parser->str[0], F_OK) == 0)
+		return (0);
+	if (!is_executable(tools, parser->str, tools->env))
+		return (1);
+	cmd_path = NULL;
+	found = path_index_find(tools->path, parser->str[0], &cmd_path);
+	free(cmd_path);
+	if (found != 0)
+		return (0);
+	exec_err(tools, 2, parser->str[0]);
+	return (1);
+}
+
+/**
+ * @brief Closes the descriptors a command may have leaked into the shell.
+ * 
+ * Descriptors from SAVED_FD_BASE up, where the shell keeps its saved
+ * copies, and those opened by "exec N>file" are left alone.
+ * 
+ * @param tools Pointer to the tools structure.
+ */
+void	close_fds(t_tools *tools)
+{
+	int	i;
+
+	i = 3;
+	while (i < SAVED_FD_BASE)
+	{
+		if (!tools->exec_fds[i])
+			close(i);
+		i++;
+	}
+}
+
+/**
+ * @brief Applies the prefix assignments of a command in its child.
+ * 
+ * The child is about to exec, so its environment is simply replaced. An
+ * assignment to PATH also changes where the command is searched. The PATH
+ * index borrows the directory names of tools->path, so it is dropped
+ * before they are freed rather than trusting the new list's address.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param parser The command.
+ * 
+ * @return The environment to hand to execve().
+ */
+char	**prefix_apply(t_tools *tools, t_parser *parser)
+{
+	char	**env;
+
+	if (!parser->assigns)
+		return (tools->env);
+	env = prefix_env(tools->env, parser->assigns);
+	if (!env)
+		return (tools->env);
+	free_list(tools->env);
+	tools->env = env;
+	if (env_index(parser->assigns, "PATH=") >= 0)
+	{
+		path_index_free();
+		if (tools->path)
+			free_list(tools->path);
+		tools->path = get_path(tools, tools->env);
+	}
+	return (tools->env);
+}
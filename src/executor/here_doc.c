@@ -6,127 +6,183 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 18:56:33 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:16:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../includes/executor.h"
 
 /**
- * @brief Gets the status of a terminated process and updates the global status.
+ * @brief Reads the body of a here-document into a file descriptor.
  * 
- * @param status Pointer to the status variable containing the termination
- * status of the process.
+ * Lines are read until the delimiter, end-of-file or SIGINT and written to
+ * fd as they come, so the size of the body is not bound by a pipe buffer
+ * and nothing has to drain it concurrently.
+ * 
+ * Unless the delimiter was quoted, variables are expanded in each line.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param fd The descriptor the body is written to.
+ * @param delimiter The delimiter token of the here-document.
+ * 
+ * @return 1 when the body is complete, 0 if it was interrupted.
  */
-void	get_status(int *status)
+int	get_here_doc(t_tools *tools, int fd, t_lexer *delimiter)
 {
-	int	sig;
+	char	*line;
 
-	if (WIFSIGNALED(*status))
+	while (1)
 	{
-		sig = WTERMSIG(*status);
-		if (sig == SIGINT)
-			global_status()->nbr = 130;
-		else if (sig == SIGQUIT)
-			global_status()->nbr = 131;
+		line = readline("> ");
+		if (global_status()->nbr == 130)
+		{
+			free(line);
+			return (0);
+		}
+		if (!line || ft_strcmp(line, delimiter->words) == 0)
+		{
+			if (!line)
+				eof_sig_msg(tools, line, delimiter->words);
+			free(line);
+			return (1);
+		}
+		if (!delimiter->quoted)
+			line = expand_heredoc_line(tools, line);
+		if (line)
+			write(fd, line, ft_strlen(line));
+		write(fd, "\n", 1);
+		free(line);
 	}
-	else if (WIFEXITED(*status))
-		global_status()->nbr = WEXITSTATUS(*status);
 }
 
 /**
- * @brief Waits for a here-document process to finish and handles its status.
+ * @brief Collects a here-document into an anonymous file.
+ * 
+ * The body is stored in a memfd (or an unlinked temporary file) that is
+ * rewound afterwards, ready to be handed to a command as its stdin. It is
+ * typed at a "> " prompt in interactive mode and taken from the script
+ * itself otherwise.
  * 
- * @param tools Pointer to the tools structure containing necessary data.
- * @param status Pointer to the status variable containing the termination
- * status of the process.
- * @param pid Process ID of the here-document process.
+ * @param tools Pointer to the tools structure.
+ * @param delimiter The delimiter token of the here-document.
+ * 
+ * @return The descriptor holding the body, or -1 on error or interruption.
  */
-void	status_heredoc(t_tools *tools, int *status, int pid)
+int	here_doc(t_tools *tools, t_lexer *delimiter)
 {
-	waitpid(pid, status, 0);
-	get_status(status);
-	if (global_status()->nbr)
-		free_and_exit(tools, global_status()->nbr);
-	dup2(tools->fd[0], STDIN_FILENO);
-	close(tools->fd[0]);
-	handle_child_sigaction();
+	int	fd;
+
+	fd = anon_file();
+	if (fd < 0)
+	{
+		perror("minishell: here-document");
+		global_status()->nbr = EXIT_FAILURE;
+		return (-1);
+	}
+	if ((tools->nint_mode && !script_here_doc(tools, fd, delimiter))
+		|| (!tools->nint_mode && !get_here_doc(tools, fd, delimiter)))
+	{
+		close(fd);
+		return (-1);
+	}
+	lseek(fd, 0, SEEK_SET);
+	return (fd);
 }
 
 /**
- * @brief Closes the file descriptor for a here document and
- * exits with the specified status.
+ * @brief Collects every here-document of a single command.
  * 
- * This function frees memory associated with the parser and tools,
- * closes the file descriptor for the here document,
- * and exits with the specified status.
+ * @param tools Pointer to the tools structure.
+ * @param parser The command whose here-documents are read, in order. A
+ * here-string has no body and is skipped.
  * 
- * @param tools A pointer to the tools structure.
- * @param fd The file descriptor for the here document.
- * @param status The exit status for the program.
+ * @return 1 on success, 0 on error or interruption.
  */
-
-void	get_here_doc(t_tools *tools, int fd[2], char *delimiter)
+int	parser_heredocs(t_tools *tools, t_parser *parser)
 {
-	char	*line;
+	t_lexer	*current;
+	int		i;
 
-	while (1)
+	parser->heredocs = malloc(parser->nb_heredocs * sizeof(int));
+	if (!parser->heredocs)
+		return (0);
+	ft_memset(parser->heredocs, -1, parser->nb_heredocs * sizeof(int));
+	parser->heredoc_index = 0;
+	i = 0;
+	current = parser->redirections;
+	while (current && current->next && i < parser->nb_heredocs)
 	{
-		line = readline("> ");
-		if (global_status()->nbr == 130)
+		if (current->token == '<' && current->next->token == '<'
+			&& current->next->next)
 		{
-			free(line);
-			free_and_exit(tools, global_status()->nbr);
+			current = current->next->next;
+			if (current->token != '<')
+				parser->heredocs[i] = here_doc(tools, current);
+			if (current->token != '<' && parser->heredocs[i++] < 0)
+				return (0);
 		}
-		if (!line)
-		{
-			eof_sig_msg(tools, line, delimiter);
-			free_and_exit(tools, EXIT_SUCCESS);
-		}
-		if (ft_strcmp(line, delimiter) == 0)
-		{
-			free(line);
-			free_and_exit(tools, EXIT_SUCCESS);
-		}
-		write(fd[1], line, ft_strlen(line));
-		write(fd[1], "\n", 1);
-		free(line);
+		current = current->next;
 	}
+	return (1);
 }
 
 /**
- * @brief Implements here documents functionality.
+ * @brief Collects the here-documents of a whole command line up front.
  * 
- * This function creates a child process to handle here documents input.
+ * Every body is read in the shell itself before any stage of the pipeline
+ * is forked, so no stage has to be stopped while the user types and no
+ * extra process is needed. Ctrl-C abandons the command line.
  * 
- * @param limiter The delimiter indicating the end of input.
- * @param original_stdout The original file descriptor for stdout.
+ * @param tools Pointer to the tools structure.
+ * 
+ * @return 1 if the command line can run, 0 otherwise.
  */
-void	here_doc(t_tools *tools, char *delimiter)
+int	collect_heredocs(t_tools *tools)
 {
-	pid_t	pid;
-	int		status;
+	t_parser	*parser;
+	int			status;
+	int			ok;
 
-	if (pipe(tools->fd) == -1)
-	{
-		perror("Error creating pipes");
-		exit (EXIT_FAILURE);
-	}
-	pid = fork();
-	if (pid == -1)
+	status = global_status()->nbr;
+	global_status()->nbr = 0;
+	handle_heredoc_sigaction();
+	ok = 1;
+	parser = tools->parser;
+	while (ok && parser)
 	{
-		perror("Error in child process");
-		exit (EXIT_FAILURE);
+		if (parser->nb_heredocs)
+			ok = parser_heredocs(tools, parser);
+		parser = parser->next;
 	}
-	if (pid == 0)
+	handle_child_sigaction();
+	if (global_status()->nbr == 130)
 	{
-		close(tools->fd[0]);
-		global_status()->nbr = 0;
-		get_here_doc(tools, tools->fd, delimiter);
+		dup2(tools->original_stdin, STDIN_FILENO);
+		ft_putstr_fd("\n", STDOUT_FILENO);
 	}
-	else
+	else if (ok)
+		global_status()->nbr = status;
+	return (ok);
+}
+
+/**
+ * @brief Closes and frees the here-document bodies of a command.
+ * 
+ * @param parser The command whose here-documents are released.
+ */
+void	close_heredocs(t_parser *parser)
+{
+	int	i;
+
+	if (!parser->heredocs)
+		return ;
+	i = 0;
+	while (i < parser->nb_heredocs)
 	{
-		close(tools->fd[1]);
-		status_heredoc (tools, &status, pid);
+		if (parser->heredocs[i] >= 0)
+			close(parser->heredocs[i]);
+		i++;
 	}
+	free(parser->heredocs);
+	parser->heredocs = NULL;
 }
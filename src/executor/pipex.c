@@ -6,7 +6,7 @@
 /*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/27 18:09:57 by ftomaz-c         ###   ########.fr       */
+/*   Updated: 2026/10/18 23:32:49 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -53,12 +53,12 @@ void	minishell_pipex(t_tools *tools, t_parser *parser, int *index)
 	else if (pid == 0)
 	{
 		if (parser->stdout_flag)
-			execute_cmd(tools, parser, *index);
+			execute_cmd(tools, parser);
 		else
 		{
 			if (parser->next)
 				pipex_dup_and_close(pipe_fd[0], pipe_fd[1], STDOUT_FILENO);
-			execute_cmd(tools, parser, *index);
+			execute_cmd(tools, parser);
 		}
 		free_and_exit(tools, global_status()->nbr);
 	}
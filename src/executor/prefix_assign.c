@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prefix_assign.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:49:52 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:24:53 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Finds the environment entry for the variable an entry sets.
+ * 
+ * @param env The environment.
+ * @param entry A "NAME=value" entry.
+ * 
+ * @return The index of the entry for NAME, or -1 if there is none.
+ */
+int	env_index(char **env, char *entry)
+{
+	int	len;
+	int	i;
+
+	len = 0;
+	while (entry[len] && entry[len] != '=')
+		len++;
+	i = 0;
+	while (env && env[i])
+	{
+		if (!ft_strncmp(env[i], entry, len)
+			&& (env[i][len] == '=' || !env[i][len]))
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Sets an entry in an environment that has room for it.
+ * 
+ * @param env The environment, with a free slot after its last entry.
+ * @param entry The "NAME=value" entry, copied.
+ * 
+ * @return 1 on success, 0 on failure.
+ */
+static int	env_put(char **env, char *entry)
+{
+	char	*dup;
+	int		i;
+
+	dup = ft_strdup(entry);
+	if (!dup)
+		return (0);
+	i = env_index(env, entry);
+	if (i < 0)
+		i = count_lines(env);
+	else
+		free(env[i]);
+	env[i] = dup;
+	return (1);
+}
+
+/**
+ * @brief Builds the environment of a command with prefix assignments.
+ * 
+ * The environment is copied once with the assignments laid over it, in
+ * place of the export and unset that would rebuild it twice.
+ * 
+ * @param env The environment of the shell, left untouched.
+ * @param assigns The "NAME=value" assignments of the command.
+ * 
+ * @return The new environment, or NULL on failure.
+ */
+char	**prefix_env(char **env, char **assigns)
+{
+	char	**new_env;
+	int		done;
+	int		i;
+
+	new_env = ft_calloc(count_lines(env) + count_lines(assigns) + 1,
+			sizeof(char *));
+	done = (new_env != NULL);
+	i = 0;
+	while (done && env && env[i])
+	{
+		new_env[i] = ft_strdup(env[i]);
+		done = (new_env[i++] != NULL);
+	}
+	i = 0;
+	while (done && assigns[i])
+		done = env_put(new_env, assigns[i++]);
+	if (done)
+		return (new_env);
+	if (new_env)
+		free_list(new_env);
+	return (NULL);
+}
+
+/**
+ * @brief Gives one assigned variable back its value.
+ * 
+ * Only a variable that still holds the assigned value is given back its
+ * old one. A variable the command set again or unset keeps that change.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param saved The environment from before the command.
+ * @param assign The assignment.
+ */
+static void	env_reset(t_tools *tools, char **saved, char *assign)
+{
+	int	i;
+	int	old;
+
+	i = env_index(tools->env, assign);
+	if (i < 0 || ft_strcmp(tools->env[i], assign))
+		return ;
+	old = env_index(saved, assign);
+	free(tools->env[i]);
+	if (old >= 0)
+		tools->env[i] = ft_strdup(saved[old]);
+	if (old < 0 || !tools->env[i])
+		ft_memmove(tools->env + i, tools->env + i + 1,
+			(count_lines(tools->env + i + 1) + 1) * sizeof(char *));
+}
+
+/**
+ * @brief Gives the assigned variables back their values, in place.
+ * 
+ * Called once a builtin or function ran with the environment built by
+ * prefix_env(). Whatever else it changed in the environment is kept.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param saved The environment from before the command, freed.
+ * @param assigns The assignments of the command.
+ */
+void	prefix_restore(t_tools *tools, char **saved, char **assigns)
+{
+	int	j;
+
+	j = 0;
+	while (assigns[j])
+		env_reset(tools, saved, assigns[j++]);
+	free_list(saved);
+}
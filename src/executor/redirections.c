@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/27 23:18:36 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:16:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,33 +22,23 @@
  * performs stdin redirection, and closes the file descriptor.
  * If the stdin flag indicates '<<' (LESS_LESS), it initiates a here document.
  * 
- * @param tools Pointer to the tools structure containing environment
- * and execution context.
  * @param parser Pointer to the parser containing stdin redirection
  * information.
  * @param fd The file descriptor associated with stdin redirection.
+ * 
+ * @return 0 on success, 1 if the file could not be opened.
  */
-int	set_stdin(t_tools *tools, t_parser *parser, int fd)
+int	set_stdin(t_parser *parser, int fd)
 {
 	int	fd_infile;
 
-	(void)tools;
 	if (parser->stdin_flag == LESS)
 	{
 		fd_infile = open (parser->stdin_file_name, O_RDONLY);
 		if (fd_infile < 0)
 		{
 			std_err(errno, parser->stdin_file_name);
-			if (errno == 2 && parser->next)
-			{
-				global_status()->nbr = 127;
-				return (1);
-			}
-			else
-			{
-				global_status()->nbr = EXIT_FAILURE;
-				free_and_exit(tools, global_status()->nbr);
-			}
+			return (1);
 		}
 		dup2(fd_infile, fd);
 		if (fd_infile != fd)
@@ -61,30 +51,32 @@ int	set_stdin(t_tools *tools, t_parser *parser, int fd)
  * @brief Handles redirections for a parsed command.
  * 
  * This function parses the redirections in a command and sets 
- * up stdin and stdout accordingly.
+ * up stdin and stdout accordingly. A here-document was collected before,
+ * a here-string is written here.
  * 
  * @param parser The parser containing redirection information.
  */
 
-t_lexer	*set_input(t_tools *tools, t_parser *parser, t_lexer *redirection,
-			int fd)
+t_lexer	*set_input(t_parser *parser, t_lexer *redirection, int fd)
 {
 	t_lexer		*current;
 
 	current = redirection;
 	current = current->next;
+	if (current->token == '&')
+		return (set_dup(parser, current, fd));
+	if (parser->stdin_flag == LESS_LESS_LESS)
+		return (set_here_string(parser, current->next->next, fd));
 	if (parser->stdin_flag == LESS_LESS)
 	{
-		handle_heredoc_sigaction();
 		current = current->next;
 		parser->delimiter = current->words;
-		dup2(tools->original_stdout, STDOUT_FILENO);
-		dup2(tools->original_stdin, STDIN_FILENO);
-		here_doc(tools, parser->delimiter);
+		if (parser->heredoc_index < parser->nb_heredocs)
+			dup2(parser->heredocs[parser->heredoc_index++], fd);
 	}
 	else if (parser->stdin_flag == LESS)
 		parser->stdin_file_name = current->words;
-	if (set_stdin(tools, parser, fd))
+	if (set_stdin(parser, fd))
 	{
 		free_list(parser->str);
 		parser->str = NULL;
@@ -99,33 +91,31 @@ t_lexer	*set_input(t_tools *tools, t_parser *parser, t_lexer *redirection,
  * if stdout redirection is detected.
  * 
  * @param parser The parser containing redirection information.
+ * 
+ * @return 0 on success, 1 if the file could not be opened.
  */
-void	set_stdout(t_parser *parser, int fd)
+int	set_stdout(t_parser *parser, int fd)
 {
 	int	fd_outfile;
 
 	fd_outfile = 0;
 	if (parser->stdout_flag == GREAT)
-	{
 		fd_outfile = open(parser->stdout_file_name, O_CREAT | O_RDWR
 				|O_TRUNC, 0644);
-		if (fd_outfile < 0)
-			std_err(errno, parser->stdout_file_name);
-		dup2(fd_outfile, fd);
-	}
 	else if (parser->stdout_flag == GREAT_GREAT)
-	{
 		fd_outfile = open(parser->stdout_file_name, O_CREAT | O_RDWR
 				| O_APPEND, 0644);
-		if (fd_outfile < 0)
-			std_err(errno, parser->stdout_file_name);
-		dup2(fd_outfile, fd);
+	if (fd_outfile < 0)
+	{
+		std_err(errno, parser->stdout_file_name);
+		return (1);
 	}
+	dup2(fd_outfile, fd);
 	if (parser->fd_err)
 		dup2(fd_outfile, parser->fd_err);
 	if (fd_outfile != fd)
 		close(fd_outfile);
-	return ;
+	return (0);
 }
 
 /**
@@ -152,6 +142,8 @@ t_lexer	*set_output(t_parser *parser, t_lexer *redirection, int fd)
 
 	current = redirection;
 	current = current->next;
+	if (current->token == '&')
+		return (set_dup(parser, current, fd));
 	if (parser->stdout_flag == GREAT_GREAT)
 	{
 		current = current->next;
@@ -159,7 +151,11 @@ t_lexer	*set_output(t_parser *parser, t_lexer *redirection, int fd)
 	}
 	else if (parser->stdout_flag == GREAT)
 		parser->stdout_file_name = current->words;
-	set_stdout(parser, fd);
+	if (set_stdout(parser, fd))
+	{
+		free_list(parser->str);
+		parser->str = NULL;
+	}
 	return (current);
 }
 
@@ -171,19 +167,19 @@ t_lexer	*set_output(t_parser *parser, t_lexer *redirection, int fd)
  * sets up the appropriate file descriptors, and performs
  * stdin and stdout redirection
  * based on the redirection tokens and parser flags.
+ * It stops at the first redirection that fails, in which case parser->str
+ * is freed and set to NULL so the command is not run. Nothing here exits,
+ * so it is safe to call from the shell process itself.
  * 
- * @param tools Pointer to the tools structure containing
- * environment and execution context.
  * @param parser Pointer to the parser containing redirection information.
  */
-void	redirection(t_tools *tools, t_parser *parser, int *index)
+void	redirection(t_parser *parser)
 {
 	t_lexer	*current;
 	int		fd;
 
-	broadcast_signal(tools, *index, SIGSTOP);
 	current = parser->redirections;
-	while (current)
+	while (current && parser->str)
 	{
 		fd = set_fd(current, parser);
 		if (current->token == '&')
@@ -193,7 +189,7 @@ void	redirection(t_tools *tools, t_parser *parser, int *index)
 		if (current->token == '<')
 		{
 			set_stdin_flag(parser, current);
-			current = set_input(tools, parser, current, fd);
+			current = set_input(parser, current, fd);
 		}
 		if (current->token == '>')
 		{
@@ -202,5 +198,4 @@ void	redirection(t_tools *tools, t_parser *parser, int *index)
 		}
 		current = current->next;
 	}
-	broadcast_signal(tools, *index, SIGCONT);
 }
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   redirections_dup.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:53:35 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:16:14 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+
+/**
+ * @brief Converts the word after "<&" or ">&" to a descriptor number.
+ * 
+ * @param word The word.
+ * 
+ * @return The descriptor, or -1 if the word is not a valid number.
+ */
+static int	dup_source(char *word)
+{
+	int	fd;
+	int	i;
+
+	fd = 0;
+	i = 0;
+	while (ft_isdigit(word[i]) && fd < MAX_FDS)
+		fd = fd * 10 + word[i++] - '0';
+	if (i == 0 || word[i] || fd >= MAX_FDS)
+		return (-1);
+	return (fd);
+}
+
+/**
+ * @brief Handles "N>&M", "N<&M" and "N>&-" redirections.
+ * 
+ * The descriptor fd becomes a copy of M, or is closed when the word is
+ * "-". On failure parser->str is freed and set to NULL so the command is
+ * not run, like for the other redirections.
+ * 
+ * @param parser The parser containing redirection information.
+ * @param amp The '&' token following the redirection operator.
+ * @param fd The descriptor being redirected.
+ * 
+ * @return The word token, the last one of the redirection.
+ */
+t_lexer	*set_dup(t_parser *parser, t_lexer *amp, int fd)
+{
+	t_lexer	*word;
+	int		from;
+
+	word = amp->next;
+	if (ft_strcmp(word->words, "-") == 0)
+	{
+		close(fd);
+		return (word);
+	}
+	from = dup_source(word->words);
+	if (from < 0)
+		errno = EBADF;
+	if (from < 0 || (from != fd && dup2(from, fd) < 0)
+		|| (from == fd && fcntl(fd, F_GETFD) < 0))
+	{
+		std_err(errno, word->words);
+		free_list(parser->str);
+		parser->str = NULL;
+	}
+	return (word);
+}
+
+/**
+ * @brief Handles "N<<< word" redirections.
+ * 
+ * The shell writes the expanded word and a newline into an anonymous file
+ * and rewinds it, in a single call and without any helper process, and
+ * the descriptor fd reads from it. On failure parser->str is freed and
+ * set to NULL so the command is not run.
+ * 
+ * @param parser The parser containing redirection information.
+ * @param word The word token of the here-string.
+ * @param fd The descriptor being redirected.
+ * 
+ * @return The word token, the last one of the redirection.
+ */
+t_lexer	*set_here_string(t_parser *parser, t_lexer *word, int fd)
+{
+	struct iovec	iov[2];
+	int				file;
+
+	iov[0] = (struct iovec){word->words, ft_strlen(word->words)};
+	iov[1] = (struct iovec){"\n", 1};
+	file = anon_file();
+	if (file < 0 || writev(file, iov, 2) < 0 || lseek(file, 0, SEEK_SET) < 0
+		|| dup2(file, fd) < 0)
+	{
+		perror("minishell: here-string");
+		global_status()->nbr = EXIT_FAILURE;
+		free_list(parser->str);
+		parser->str = NULL;
+	}
+	if (file >= 0 && file != fd)
+		close(file);
+	return (word);
+}
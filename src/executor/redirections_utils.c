@@ -6,7 +6,7 @@
 /*   By: ftomazc < ftomaz-c@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/24 00:50:29 by ftomazc          ###   ########.fr       */
+/*   Updated: 2026/10/19 01:16:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -33,7 +33,10 @@ void	set_stdin_flag(t_parser *parser, t_lexer *redirections)
 		parser->stdout_flag = 0;
 		if (current->token == '<' && current->next->token == '>')
 			return ;
-		if (current->next && current->next->token == '<')
+		if (current->next && current->next->token == '<'
+			&& current->next->next && current->next->next->token == '<')
+			parser->stdin_flag = LESS_LESS_LESS;
+		else if (current->next && current->next->token == '<')
 			parser->stdin_flag = LESS_LESS;
 		else if (current->next->words)
 			parser->stdin_flag = LESS;
@@ -150,7 +153,10 @@ int	set_fd(t_lexer *current, t_parser *parser)
  * This function prints error messages to STDERR based on the given
  * error code and, optionally, a string.
  * It handles specific error cases such as "No such file or
- * directory," "Permission denied," and "Is a directory."
+ * directory," "Permission denied," and "Is a directory," and falls back
+ * to strerror() for the others.
+ * 
+ * The exit status is set to 1; it is up to the caller to skip the command.
  * 
  * @param err The error code indicating the type of error.
  * @param str Optional string to be included in the error message.
@@ -160,14 +166,15 @@ void	std_err(int err, char *str)
 	if (str)
 		ft_putstr_fd(str, STDERR_FILENO);
 	if (err == 2)
-	{
 		ft_putstr_fd(": No such file or directory\n", STDERR_FILENO);
-		return ;
-	}
 	else if (err == 13)
 		ft_putstr_fd(": Permission denied\n", STDERR_FILENO);
 	else if (err == 21)
 		ft_putstr_fd(": Is a directory\n", STDERR_FILENO);
+	else
+	{
+		ft_putstr_fd(": ", STDERR_FILENO);
+		ft_putendl_fd(strerror(err), STDERR_FILENO);
+	}
 	global_status()->nbr = EXIT_FAILURE;
-	exit (global_status()->nbr);
 }
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   saved_fds.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:43:23 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:03:43 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/executor.h"
+
+/**
+ * @brief Saves a copy of a descriptor so it can be restored later.
+ * 
+ * The copy is made above SAVED_FD_BASE, out of the way of the descriptors
+ * a command line usually redirects, and is close-on-exec.
+ * 
+ * @param saved The set of saved descriptors.
+ * @param fd The descriptor to save. Nothing is done if it is already saved.
+ */
+void	save_fd(t_saved_fds *saved, int fd)
+{
+	int	i;
+
+	i = 0;
+	while (i < saved->count)
+		if (saved->fd[i++] == fd)
+			return ;
+	if (saved->count == MAX_SAVED_FDS)
+		return ;
+	saved->fd[saved->count] = fd;
+	saved->copy[saved->count] = fcntl(fd, F_DUPFD_CLOEXEC, SAVED_FD_BASE);
+	saved->count++;
+}
+
+/**
+ * @brief Saves every descriptor a command's redirections may replace.
+ * 
+ * The standard descriptors are always saved, plus any descriptor named
+ * explicitly, like the 3 in "3> file".
+ * 
+ * @param parser The command whose redirections are inspected.
+ * @param saved The set of saved descriptors to fill.
+ */
+void	save_redirected_fds(t_parser *parser, t_saved_fds *saved)
+{
+	t_lexer	*current;
+
+	saved->count = 0;
+	save_fd(saved, STDIN_FILENO);
+	save_fd(saved, STDOUT_FILENO);
+	save_fd(saved, STDERR_FILENO);
+	current = parser->redirections;
+	while (current)
+	{
+		if (ft_isdigit(current->token))
+		{
+			save_fd(saved, get_digits_token(current));
+			while (current->next && ft_isdigit(current->next->token))
+				current = current->next;
+		}
+		current = current->next;
+	}
+}
+
+/**
+ * @brief Puts back the descriptors saved by save_redirected_fds().
+ * 
+ * A descriptor that was closed before the command is closed again.
+ * 
+ * @param saved The set of saved descriptors.
+ */
+void	restore_fds(t_saved_fds *saved)
+{
+	int	i;
+
+	i = 0;
+	while (i < saved->count)
+	{
+		if (saved->copy[i] >= 0)
+		{
+			dup2(saved->copy[i], saved->fd[i]);
+			close(saved->copy[i]);
+		}
+		else
+			close(saved->fd[i]);
+		i++;
+	}
+	saved->count = 0;
+}
+
+/**
+ * @brief Runs a builtin with redirections in the shell process.
+ * 
+ * The descriptors touched by the redirections are saved, the redirections
+ * are applied, the builtin runs and everything is restored, so no child is
+ * needed for things like "echo line >> log". If a redirection fails the
+ * builtin is skipped and the exit status is 1. Read-ahead of the read
+ * builtin is given back on both sides, since the descriptors change.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param parser The builtin command.
+ */
+void	run_builtin_redirected(t_tools *tools, t_parser *parser)
+{
+	t_saved_fds	saved;
+
+	read_sync();
+	if (parser->builtin == cmd_exec && !parser->str[1])
+	{
+		redirection(parser);
+		if (parser->str)
+			run_builtin(tools, parser);
+		return ;
+	}
+	save_redirected_fds(parser, &saved);
+	redirection(parser);
+	if (parser->str)
+		run_builtin(tools, parser);
+	read_sync();
+	restore_fds(&saved);
+}
@@ -6,7 +6,7 @@
 /*   By: ftomaz-c <ftomaz-c@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/24 14:03:57 by ftomaz-c         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:24:33 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -36,7 +36,7 @@ int	check_conditions_expander(char *str, int position)
 		return (0);
 	if (!(str[position + 1]))
 		return (0);
-	if (str[position + 1] == '?')
+	if (is_special_param(str[position + 1]))
 		return (1);
 	if (!ft_isalnum(str[position + 1]) && str[position + 1] != '_')
 		return (0);
@@ -167,26 +167,32 @@ char	*expand_tilde(char *str, char *home_var)
  * in the list and replaces them with their corresponding 
  * values from the environment.
  * 
- * @param env The environment containing variable-value pairs.
+ * Arithmetic expansions, command and process substitutions are done
+ * first. Variables are then looked up in
+ * tools->env, which an assignment in them may have moved.
+ * 
  * @param list The list of strings to be processed.
+ * @param tools A pointer to the tools structure.
  * 
  * @return None.
  */
-char	*expander(char **env, char **list, t_tools *tools)
+char	*expander(char **list, t_tools *tools)
 {
 	int		index;
 	char	**split;
-	char	*line;
 
 	index = 0;
 	while (list[index])
 	{
+		herestring_quote(list, index);
+		if (!expand_substs(tools, &list[index], 1))
+			return (NULL);
 		split = NULL;
 		if (is_expandable(list, &index))
 			split = split_expander(list[index]);
 		if (split)
 		{
-			expand_split(env, split);
+			expand_split(tools->env, split);
 			free(list[index]);
 			list[index] = merge_list_of_strings(split, NULL);
 			free_list(split);
@@ -195,6 +201,5 @@ char	*expander(char **env, char **list, t_tools *tools)
 			list[index] = expand_tilde(list[index], tools->home);
 		index++;
 	}
-	line = merge_list_of_strings(list, " ");
-	return (line);
+	return (merge_list_of_strings(list, " "));
 }
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_arith.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:59:01 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:13:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Finds the end of an arithmetic expansion.
+ * 
+ * @param s The word.
+ * @param i Index of the '$' of "$((".
+ * 
+ * @return Index of the closing "))", or -1 if there is none.
+ */
+static int	arith_close(char *s, int i)
+{
+	int	depth;
+
+	depth = 0;
+	i += 3;
+	while (s[i])
+	{
+		if (s[i] == ')' && !depth && s[i + 1] == ')')
+			return (i);
+		depth += (s[i] == '(') - (s[i] == ')');
+		i++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Returns the value of a parameter named in a text.
+ * 
+ * @param env The environment.
+ * @param name The start of the name.
+ * @param len The length of the name.
+ * 
+ * @return The newly allocated value, or NULL if it is unset.
+ */
+static char	*arith_param(char **env, char *name, int len)
+{
+	char	*var;
+	char	*value;
+
+	var = ft_substr(name, 0, len);
+	if (!var)
+		return (NULL);
+	value = param_value(env, var);
+	free(var);
+	return (value);
+}
+
+/**
+ * @brief Expands the parameters of an arithmetic expression as text.
+ * 
+ * Quotes are dropped, as they only group text here.
+ * 
+ * @param env The environment.
+ * @param s The expression. It is freed.
+ * 
+ * @return The newly allocated expression, or NULL on allocation error.
+ */
+static char	*arith_dollars(char **env, char *s)
+{
+	char	*out;
+	char	*value;
+	int		i;
+	int		end;
+
+	out = ft_strdup("");
+	i = 0;
+	while (out && s[i])
+	{
+		end = i + 1;
+		if (s[i] == '$' && (is_special_param(s[i + 1])
+				|| ft_isalpha(s[i + 1]) || s[i + 1] == '_'))
+			end = get_end_position(s, i);
+		value = NULL;
+		if (end > i + 1)
+			value = arith_param(env, s + i + 1, end - i - 1);
+		if (value)
+			out = append_len(out, value, ft_strlen(value));
+		else if (end == i + 1 && s[i] != '"' && s[i] != '\'')
+			out = append_len(out, s + i, 1);
+		free(value);
+		i = end;
+	}
+	free(s);
+	return (out);
+}
+
+/**
+ * @brief Replaces an arithmetic expansion of a word by its value.
+ * 
+ * Nested expansions are replaced first. An expression written without any
+ * expansion in it reads the same on every run, so only those get their
+ * parse tree cached.
+ * 
+ * @param tools The tools struct.
+ * @param word The word, replaced on success.
+ * @param start Index of the '$' of "$((".
+ * 
+ * @return The index just past the value in the new word, or -1 on error.
+ */
+int	expand_arith(t_tools *tools, char **word, int start)
+{
+	char		*text;
+	long long	value;
+	char		buffer[ARITH_NUMBER];
+	int			literal;
+	int			end;
+
+	end = arith_close(*word, start);
+	if (end < 0)
+		return (start + 1);
+	text = ft_substr(*word, start + 3, end - start - 3);
+	literal = text && !ft_strchr(text, '$') && !ft_strchr(text, '`');
+	if (text && !literal && !expand_substs(tools, &text, 0))
+	{
+		free(text);
+		return (-1);
+	}
+	if (text)
+		text = arith_dollars(tools->env, text);
+	literal = text && arith_eval(tools, text, literal, &value);
+	free(text);
+	if (!literal)
+		return (-1);
+	return (word_splice(word, start, end + 2,
+			ft_strdup(arith_lltoa(value, buffer))));
+}
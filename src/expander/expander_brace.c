@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_brace.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:30:27 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Lists the values, or the keys, a list expansion stands for.
+ * 
+ * A variable that is not an array is a list of its value alone, at
+ * index 0.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param brace The parts of the expansion.
+ * @param array The array, or NULL if there is none by that name.
+ * 
+ * @return A newly allocated list, or NULL on allocation error.
+ */
+static char	**brace_values(t_tools *tools, t_brace *brace, t_array *array)
+{
+	char	**list;
+
+	if (array)
+		return (array_values(array, brace->op == '!'));
+	list = ft_calloc(2, sizeof(char *));
+	if (list)
+		list[0] = param_value(tools->env, brace->name);
+	if (list && list[0] && brace->op == '!')
+	{
+		free(list[0]);
+		list[0] = ft_strdup("0");
+	}
+	return (list);
+}
+
+/**
+ * @brief Expands "${name[@]}", "${name[*]}", "${#name[@]}" and
+ * "${!name[@]}".
+ * 
+ * Inside double quotes, each value of "${name[@]}" is quoted on its own
+ * and the quotes are closed between them, so that each value stays a
+ * word of its own.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param brace The parts of the expansion.
+ * @param quote '"' if the expansion is inside double quotes, else 0.
+ * 
+ * @return The newly allocated quoted text, or NULL on allocation error.
+ */
+static char	*brace_list(t_tools *tools, t_brace *brace, char quote)
+{
+	t_array	*array;
+	char	**list;
+	char	*text;
+	char	*quoted;
+	int		each;
+
+	array = array_find(brace->name);
+	if (array && brace->op == '#')
+		return (ft_itoa(array_length(array)));
+	list = brace_values(tools, brace, array);
+	if (!list)
+		return (NULL);
+	each = quote && brace->sub[0] == '@';
+	if (brace->op == '#')
+		text = ft_itoa(count_lines(list));
+	else
+		text = brace_join(list, each);
+	free_list(list);
+	if (!text || brace->op == '#' || each)
+		return (text);
+	quoted = subst_quote(text, quote);
+	free(text);
+	return (quoted);
+}
+
+/**
+ * @brief Returns an element of an array.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param array The array.
+ * @param sub The raw subscript, expanded first.
+ * 
+ * @return A newly allocated copy of the element, or NULL if it is unset.
+ */
+static char	*brace_elem(t_tools *tools, t_array *array, char *sub)
+{
+	char	*key;
+	char	*elem;
+
+	key = expand_word(tools, sub);
+	elem = NULL;
+	if (key)
+		elem = array_elem(tools, array, key);
+	free(key);
+	if (!elem)
+		return (NULL);
+	return (ft_strdup(elem));
+}
+
+/**
+ * @brief Expands "${name}", "${name[subscript]}" and their "${#...}"
+ * lengths.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param brace The parts of the expansion.
+ * @param quote '"' if the expansion is inside double quotes, else 0.
+ * 
+ * @return The newly allocated quoted text, or NULL on allocation error.
+ */
+static char	*brace_value(t_tools *tools, t_brace *brace, char quote)
+{
+	t_array	*array;
+	char	*value;
+	char	*text;
+
+	array = NULL;
+	if (brace->sub)
+		array = array_find(brace->name);
+	if (array)
+		value = brace_elem(tools, array, brace->sub);
+	else
+		value = param_value(tools->env, brace->name);
+	if (brace->op == '#' && value)
+		text = ft_itoa(ft_strlen(value));
+	else if (brace->op == '#')
+		text = ft_strdup("0");
+	else if (value)
+		text = subst_quote(value, quote);
+	else
+		text = ft_strdup("");
+	free(value);
+	return (text);
+}
+
+/**
+ * @brief Replaces a "${...}" expansion of a word by its value.
+ * 
+ * Only the plain forms are known, with or without an array subscript.
+ * Any other form is a bad substitution, which is an expansion error. A
+ * word that is only "${name[@]}" with no values is removed, quotes and
+ * all.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param word The word, replaced on success.
+ * @param i Index of the '$'.
+ * @param quote '"' if the expansion is inside double quotes, else 0.
+ * 
+ * @return The index just past the value in the new word, or -1 on error.
+ */
+int	expand_brace(t_tools *tools, char **word, int i, char quote)
+{
+	t_brace	brace;
+	char	*text;
+	int		kind;
+	int		end;
+
+	end = subst_end(*word, i);
+	if (end < 0)
+		return (i + 1);
+	kind = brace_parse(*word + i + 2, &brace);
+	text = NULL;
+	if (kind == 2)
+		text = brace_list(tools, &brace, quote);
+	else if (kind == 1)
+		text = brace_value(tools, &brace, quote);
+	else
+		brace_error(*word + i, end - i);
+	free(brace.name);
+	free(brace.sub);
+	if (kind == 2 && text && !*text && quote && (*word)[end - 3] == '@'
+		&& i == 1 && !ft_strcmp(*word + end, "\""))
+		return (word_splice(word, 0, end + 1, text));
+	return (word_splice(word, i, end, text));
+}
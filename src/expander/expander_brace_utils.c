@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_brace_utils.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:29:28 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Splits the text between the braces of a "${...}" expansion.
+ * 
+ * That is an optional '#' or '!', a name and an optional subscript. The
+ * name and the subscript are newly allocated.
+ * 
+ * @param text The text just past the opening brace.
+ * @param brace The parts, filled even on error.
+ * 
+ * @return 2 for a list expansion, with a "@" or "*" subscript, 1 for any
+ * other well formed expansion, 0 for a bad substitution.
+ */
+int	brace_parse(char *text, t_brace *brace)
+{
+	int	len;
+	int	end;
+
+	brace->op = 0;
+	brace->sub = NULL;
+	if ((text[0] == '#' || text[0] == '!') && text[1] != '}')
+		brace->op = *text++;
+	len = 0;
+	while (ft_isalnum(text[len]) || text[len] == '_')
+		len++;
+	if (!len && is_special_param(text[0]))
+		len = 1;
+	brace->name = ft_substr(text, 0, len);
+	end = len;
+	if (text[len] == '[')
+		end = subscript_end(text, len) + 1;
+	if (end > len + 2)
+		brace->sub = ft_substr(text, len + 1, end - len - 2);
+	if (!brace->name || !len || text[end] != '}'
+		|| (text[len] == '[' && !brace->sub))
+		return (0);
+	if (brace->sub && (!ft_strcmp(brace->sub, "@")
+			|| !ft_strcmp(brace->sub, "*")))
+		return (2);
+	return (brace->op != '!');
+}
+
+/**
+ * @brief Prepares the values of a list expansion for joining.
+ * 
+ * @param list The values, quoted in place if each is 1.
+ * @param each 1 to quote each value as a double-quoted word of its own,
+ * 0 to leave them as they are.
+ * 
+ * @return The separator to join them with, or NULL on allocation error.
+ */
+static char	*join_sep(char **list, int each)
+{
+	char	*quoted;
+	int		i;
+
+	if (!each)
+		return (" ");
+	i = 0;
+	while (list[i])
+	{
+		quoted = subst_quote(list[i], '"');
+		if (!quoted)
+			return (NULL);
+		free(list[i]);
+		list[i++] = quoted;
+	}
+	return ("\" \"");
+}
+
+/**
+ * @brief Joins the values of a list expansion.
+ * 
+ * The length is worked out first, so the text is built with a single
+ * allocation however long the array is.
+ * 
+ * @param list The values.
+ * @param each 1 to quote each value as a double-quoted word of its own,
+ * 0 to join them with spaces as they are.
+ * 
+ * @return The newly allocated text, or NULL on allocation error.
+ */
+char	*brace_join(char **list, int each)
+{
+	char	*sep;
+	char	*text;
+	size_t	len;
+	size_t	j;
+	int		i;
+
+	sep = join_sep(list, each);
+	if (!sep)
+		return (NULL);
+	len = 1;
+	i = 0;
+	while (list[i])
+		len += ft_strlen(list[i++]) + ft_strlen(sep);
+	text = ft_calloc(len, 1);
+	if (!text)
+		return (NULL);
+	j = 0;
+	i = 0;
+	while (list[i])
+	{
+		if (i > 0)
+			j += ft_strlcpy(text + j, sep, len - j);
+		j += ft_strlcpy(text + j, list[i++], len - j);
+	}
+	return (text);
+}
+
+/**
+ * @brief Prints a bad substitution error.
+ * 
+ * @param text The "${...}" expansion.
+ * @param len Its length.
+ */
+void	brace_error(char *text, int len)
+{
+	ft_putstr_fd("minishell: ", STDERR_FILENO);
+	write(STDERR_FILENO, text, len);
+	ft_putendl_fd(": bad substitution", STDERR_FILENO);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_dynamic.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:17:10 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Returns the state of the dynamic variables.
+ * 
+ * @return Pointer to the state.
+ */
+t_dynamic	*shell_dynamic(void)
+{
+	static t_dynamic	dynamic;
+
+	return (&dynamic);
+}
+
+/**
+ * @brief Computes $RANDOM, a number from 0 to 32767.
+ * 
+ * The numbers come from a xorshift64* generator, seeded from the clock
+ * and the process id. A subshell reseeds it, so that it does not repeat
+ * the numbers of its parent.
+ * 
+ * @param dynamic The state of the dynamic variables.
+ * 
+ * @return The newly allocated value.
+ */
+static char	*dynamic_random(t_dynamic *dynamic)
+{
+	struct timespec	now;
+
+	if (dynamic->pid != getpid())
+	{
+		dynamic->pid = getpid();
+		clock_gettime(CLOCK_REALTIME, &now);
+		dynamic->seed = ((unsigned long long)now.tv_sec << 32)
+			^ now.tv_nsec ^ ((unsigned long long)dynamic->pid << 16);
+		dynamic->seed |= 1;
+	}
+	dynamic->seed ^= dynamic->seed >> 12;
+	dynamic->seed ^= dynamic->seed << 25;
+	dynamic->seed ^= dynamic->seed >> 27;
+	return (ft_itoa((dynamic->seed * 2685821657736338717ULL) >> 49));
+}
+
+/**
+ * @brief Computes $EPOCHREALTIME, the time since the epoch in seconds
+ * with six decimals.
+ * 
+ * @return The newly allocated value, or NULL on allocation error.
+ */
+static char	*dynamic_realtime(void)
+{
+	struct timespec	now;
+	char			num[ARITH_NUMBER];
+	char			*seconds;
+	char			*value;
+
+	clock_gettime(CLOCK_REALTIME, &now);
+	seconds = ft_strjoin(arith_lltoa(now.tv_sec, num), ".");
+	if (!seconds)
+		return (NULL);
+	value = ft_strjoin(seconds,
+			arith_lltoa(1000000 + now.tv_nsec / 1000, num) + 1);
+	free(seconds);
+	return (value);
+}
+
+/**
+ * @brief Returns the value of a variable, computing the dynamic ones.
+ * 
+ * RANDOM, SECONDS, EPOCHREALTIME and BASHPID are worked out each time
+ * they are expanded and are never stored in the environment. Once one is
+ * exported, the exported value is used instead. An array stands for its
+ * element 0.
+ * 
+ * @param env The environment.
+ * @param var The variable name.
+ * 
+ * @return The newly allocated value, or NULL if the variable is unset.
+ */
+char	*dynamic_value(char **env, char *var)
+{
+	struct timespec	now;
+	char			*value;
+
+	value = get_var_from_env(env, var);
+	if (!value)
+		value = array_first(var);
+	if (value)
+		return (value);
+	if (ft_strcmp(var, "RANDOM") == 0)
+		return (dynamic_random(shell_dynamic()));
+	if (ft_strcmp(var, "EPOCHREALTIME") == 0)
+		return (dynamic_realtime());
+	if (ft_strcmp(var, "BASHPID") == 0)
+		return (ft_itoa(getpid()));
+	if (ft_strcmp(var, "SECONDS") != 0)
+		return (NULL);
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (ft_itoa(now.tv_sec - shell_dynamic()->start.tv_sec));
+}
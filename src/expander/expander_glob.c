@@ -0,0 +1,186 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_glob.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:42:32 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:21:56 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Matches the entries of one directory against a component.
+ * 
+ * The directory is read once, and each name runs through the matcher
+ * compiled for the component.
+ * 
+ * @param out The list the matching paths are added to.
+ * @param prefix The directory to read.
+ * @param step The component to match.
+ */
+static void	glob_dir(t_glob *out, char *prefix, t_gstep *step)
+{
+	DIR				*dir;
+	struct dirent	*entry;
+	char			*path;
+
+	dir = glob_opendir(prefix);
+	if (!dir)
+		return ;
+	entry = readdir(dir);
+	while (entry)
+	{
+		path = NULL;
+		if (!glob_skip(step, entry->d_name)
+			&& glob_match(step->ops, entry->d_name))
+			path = glob_join(prefix, entry->d_name);
+		if (path && step->dir_only && !glob_isdir(path, entry))
+			free(path);
+		else
+			glob_add(out, path);
+		entry = readdir(dir);
+	}
+	closedir(dir);
+}
+
+/**
+ * @brief Appends a literal component to a path.
+ * 
+ * No directory is read. Only the last component checks that the path
+ * exists, since a missing directory fails the next read anyway.
+ * 
+ * @param out The list the path is added to.
+ * @param prefix The path so far.
+ * @param step The component to append.
+ */
+static void	glob_literal(t_glob *out, char *prefix, t_gstep *step)
+{
+	struct stat	st;
+	char		*path;
+
+	path = glob_join(prefix, step->lit);
+	if (path && (!*path || (!step->dir_only && *step->lit
+				&& lstat(path, &st) == -1)))
+		free(path);
+	else
+		glob_add(out, path);
+}
+
+/**
+ * @brief Replaces each path of a list with its matches for a component.
+ * 
+ * The pattern is compiled once and serves every directory of the list. An
+ * unquoted "**" matches any number of directories instead.
+ * 
+ * @param paths The list of paths.
+ * @param comp The raw component, quotes included.
+ * @param last 1 for the last component of the word.
+ */
+static void	glob_step(t_glob *paths, char *comp, int last)
+{
+	t_glob	out;
+	t_gstep	step;
+	char	*pattern;
+	int		i;
+
+	ft_bzero(&out, sizeof(t_glob));
+	pattern = glob_pattern(comp, glob_magic(comp));
+	step = (t_gstep){NULL, pattern, !ft_strcmp(comp, "**"), !last};
+	if (pattern && glob_magic(comp) && !step.star)
+		step.ops = glob_compile(pattern);
+	i = -1;
+	while (pattern && (step.ops || step.star || !glob_magic(comp))
+		&& ++i < paths->count)
+	{
+		if (step.star)
+			glob_star(&out, paths->paths[i], &step);
+		else if (step.ops)
+			glob_dir(&out, paths->paths[i], &step);
+		else
+			glob_literal(&out, paths->paths[i], &step);
+	}
+	free(step.ops);
+	free(pattern);
+	glob_free(paths);
+	*paths = out;
+}
+
+/**
+ * @brief Adds the sorted matches of a word to the lexer.
+ * 
+ * The matches are sorted by byte value, so their order does not depend on
+ * the locale. Each node is appended after the previous one, so the lexer
+ * is not walked once per match.
+ * 
+ * @param paths The matches, freed on return.
+ * @param lexer Pointer to the lexer structure.
+ * 
+ * @return 1 if there was a match, 0 otherwise.
+ */
+static int	glob_done(t_glob *paths, t_lexer **lexer)
+{
+	t_lexer	*node;
+	t_lexer	*last;
+	t_lexer	**tail;
+	int		i;
+	int		found;
+
+	if (paths->count > 1)
+		qsort(paths->paths, paths->count, sizeof(char *), compare_names);
+	tail = lexer;
+	i = -1;
+	while (++i < paths->count)
+	{
+		node = add_word_to_node(paths->paths[i], tail);
+		if (node)
+			last = node;
+		if (node)
+			tail = &last;
+	}
+	found = paths->count > 0;
+	glob_free(paths);
+	return (found);
+}
+
+/**
+ * @brief Expands a word into the paths it matches.
+ * 
+ * The word is matched one path component at a time. A word that matches
+ * nothing is left as it is.
+ * 
+ * @param raw The raw word, quotes included.
+ * @param lexer Pointer to the lexer structure the matches are added to.
+ * 
+ * @return 1 if the word was replaced by its matches, 0 otherwise.
+ */
+int	glob_word(char *raw, t_lexer **lexer)
+{
+	t_glob	paths;
+	char	*comp;
+	int		end;
+	int		i;
+
+	if (glob_options()->disabled || !glob_magic(raw)
+		|| glob_redirected(*lexer))
+		return (0);
+	ft_bzero(&paths, sizeof(t_glob));
+	i = (raw[0] == '/');
+	glob_add(&paths, ft_substr(raw, 0, i));
+	end = -1;
+	while (paths.count && (end == -1 || raw[end]))
+	{
+		end = glob_slash(raw, i);
+		comp = ft_substr(raw, i, end - i);
+		if (comp)
+			glob_step(&paths, comp, !raw[end]);
+		else
+			glob_free(&paths);
+		free(comp);
+		i = end + 1;
+	}
+	return (glob_done(&paths, lexer));
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_glob_utils1.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:41:06 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:44:00 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Removes the quotes of a word, optionally turning it into a
+ * pattern.
+ * 
+ * With escape set, the pattern characters the quotes protected are
+ * backslash-escaped, so they match literally.
+ * 
+ * @param raw The raw word, quotes included.
+ * @param escape 1 for a pattern, 0 for plain text.
+ * 
+ * @return The new string, or NULL on allocation error.
+ */
+char	*glob_pattern(char *raw, int escape)
+{
+	char	*pattern;
+	char	quote;
+	int		n;
+	int		i;
+
+	pattern = ft_calloc(ft_strlen(raw) * 2 + 1, sizeof(char));
+	if (!pattern)
+		return (NULL);
+	quote = 0;
+	n = 0;
+	i = -1;
+	while (raw[++i])
+	{
+		if (!quote && (raw[i] == '\'' || raw[i] == '"'))
+			quote = raw[i];
+		else if (quote && raw[i] == quote)
+			quote = 0;
+		else
+		{
+			if (escape && quote && ft_strchr("*?[]\\", raw[i]))
+				pattern[n++] = '\\';
+			pattern[n++] = raw[i];
+		}
+	}
+	return (pattern);
+}
+
+/**
+ * @brief Tells whether a word holds an unquoted pattern character.
+ * 
+ * A '[' only counts when a ']' follows, so the [ builtin costs no
+ * directory read.
+ * 
+ * @param raw The raw word, quotes included.
+ * 
+ * @return 1 if it does, 0 otherwise.
+ */
+int	glob_magic(char *raw)
+{
+	char	quote;
+	int		i;
+
+	quote = 0;
+	i = -1;
+	while (raw[++i])
+	{
+		if (!quote && (raw[i] == '\'' || raw[i] == '"'))
+			quote = raw[i];
+		else if (quote && raw[i] == quote)
+			quote = 0;
+		else if (!quote && (raw[i] == '*' || raw[i] == '?'
+				|| (raw[i] == '[' && ft_strchr(raw + i, ']'))))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Finds the end of a path component of a raw word.
+ * 
+ * @param raw The raw word, quotes included.
+ * @param i Where the component starts, outside of any quotes.
+ * 
+ * @return The index of the next unquoted '/', or of the end of the word.
+ */
+int	glob_slash(char *raw, int i)
+{
+	char	quote;
+
+	quote = 0;
+	while (raw[i] && (quote || raw[i] != '/'))
+	{
+		if (!quote && (raw[i] == '\'' || raw[i] == '"'))
+			quote = raw[i];
+		else if (quote && raw[i] == quote)
+			quote = 0;
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Appends a path to a list of matches.
+ * 
+ * The list doubles when full, so memory grows with the number of matches
+ * and not with the size of the directories read.
+ * 
+ * @param glob The list.
+ * @param path The path. The list takes it over; NULL is ignored.
+ * 
+ * @return 1 on success, 0 if memory ran out.
+ */
+int	glob_add(t_glob *glob, char *path)
+{
+	char	**paths;
+
+	if (!path)
+		return (0);
+	if (glob->count + 1 >= glob->size)
+	{
+		paths = ft_realloc(glob->paths, sizeof(char *) * (glob->size * 2
+					+ 16), sizeof(char *) * glob->size);
+		if (!paths)
+		{
+			free(path);
+			return (0);
+		}
+		glob->paths = paths;
+		glob->size = glob->size * 2 + 16;
+	}
+	glob->paths[glob->count++] = path;
+	glob->paths[glob->count] = NULL;
+	return (1);
+}
+
+/**
+ * @brief Frees a list of matches and empties it.
+ * 
+ * @param glob The list.
+ */
+void	glob_free(t_glob *glob)
+{
+	while (glob->count)
+		free(glob->paths[--glob->count]);
+	free(glob->paths);
+	ft_bzero(glob, sizeof(t_glob));
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_glob_utils2.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:42:32 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:48:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Builds the path of a directory entry.
+ * 
+ * @param prefix The directory the entry was read from. An empty prefix is
+ * the working directory.
+ * @param name The name of the entry.
+ * 
+ * @return The new path, or NULL on allocation error.
+ */
+char	*glob_join(char *prefix, char *name)
+{
+	char	*dir;
+	char	*path;
+
+	if (!*prefix)
+		return (ft_strdup(name));
+	if (prefix[ft_strlen(prefix) - 1] == '/')
+		return (ft_strjoin(prefix, name));
+	dir = ft_strjoin(prefix, "/");
+	if (!dir)
+		return (NULL);
+	path = ft_strjoin(dir, name);
+	free(dir);
+	return (path);
+}
+
+/**
+ * @brief Tells whether a directory entry is left out of the matches.
+ * 
+ * "." and ".." never match, and other hidden names only match a pattern
+ * that starts with a literal '.'.
+ * 
+ * @param step The component being matched.
+ * @param name The name of the entry.
+ * 
+ * @return 1 if the entry is skipped, 0 otherwise.
+ */
+int	glob_skip(t_gstep *step, char *name)
+{
+	if (name[0] != '.')
+		return (0);
+	if (step->lit[0] != '.' && ft_strncmp(step->lit, "\\.", 2))
+		return (1);
+	return (!ft_strcmp(name, ".") || !ft_strcmp(name, ".."));
+}
+
+/**
+ * @brief Tells whether a directory entry is a directory.
+ * 
+ * The type readdir() reported is trusted, so stat() only runs for
+ * symbolic links and file systems that do not report types.
+ * 
+ * @param path The path of the entry.
+ * @param entry The entry.
+ * 
+ * @return 1 if it is a directory, 0 otherwise.
+ */
+int	glob_isdir(char *path, struct dirent *entry)
+{
+	struct stat	st;
+
+	if (entry->d_type == DT_DIR)
+		return (1);
+	if (entry->d_type != DT_LNK && entry->d_type != DT_UNKNOWN)
+		return (0);
+	return (stat(path, &st) == 0 && S_ISDIR(st.st_mode));
+}
+
+/**
+ * @brief Tells whether the next word is the target of a redirection.
+ * 
+ * Redirection targets and here-document delimiters are not expanded.
+ * 
+ * @param lexer The words lexed so far.
+ * 
+ * @return 1 if it is, 0 otherwise.
+ */
+int	glob_redirected(t_lexer *lexer)
+{
+	while (lexer && lexer->next)
+		lexer = lexer->next;
+	return (lexer && (lexer->token == '<' || lexer->token == '>'));
+}
+
+/**
+ * @brief Opens the directory a path prefix names.
+ * 
+ * @param prefix The path so far. An empty prefix is the working directory.
+ * 
+ * @return The open directory, or NULL on error.
+ */
+DIR	*glob_opendir(char *prefix)
+{
+	if (!*prefix)
+		return (opendir("."));
+	return (opendir(prefix));
+}
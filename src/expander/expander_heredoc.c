@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_heredoc.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:39:20 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/18 23:57:04 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Appends the value of the variable starting at line[i].
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param line The here-document line.
+ * @param i Index of the first character after the '$'.
+ * @param result Pointer to the line being built.
+ * 
+ * @return The index just past the variable name.
+ */
+int	heredoc_var(t_tools *tools, char *line, int i, char **result)
+{
+	char	*name;
+	char	*value;
+	int		end;
+
+	end = i + 1;
+	while (!is_special_param(line[i])
+		&& (ft_isalnum(line[end]) || line[end] == '_'))
+		end++;
+	name = ft_substr(line, i, end - i);
+	value = param_value(tools->env, name);
+	if (value && *result)
+		*result = append_len(*result, value, ft_strlen(value));
+	free(name);
+	free(value);
+	return (end);
+}
+
+/**
+ * @brief Expands $NAME and the special parameters in a line of a
+ * here-document body.
+ * 
+ * Unlike command words, quotes have no special meaning in a here-document,
+ * so the line is scanned as plain text and the values are not split.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param line The line to expand. It is freed.
+ * 
+ * @return The expanded line, or NULL on allocation error.
+ */
+char	*expand_heredoc_line(t_tools *tools, char *line)
+{
+	char	*result;
+	int		start;
+	int		i;
+
+	if (!line || !ft_strchr(line, '$'))
+		return (line);
+	result = ft_strdup("");
+	start = 0;
+	i = 0;
+	while (result && line[i])
+	{
+		if (line[i] == '$' && (is_special_param(line[i + 1])
+				|| ft_isalpha(line[i + 1]) || line[i + 1] == '_'))
+		{
+			result = append_len(result, line + start, i - start);
+			i = heredoc_var(tools, line, i + 1, &result);
+			start = i;
+		}
+		else
+			i++;
+	}
+	if (result)
+		result = append_len(result, line + start, i - start);
+	free(line);
+	return (result);
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_herestring.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:23:00 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:24:33 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Finds where the here-string word of a raw word starts.
+ * 
+ * @param list The raw words of the line.
+ * @param index Index of the word.
+ * 
+ * @return The index in the word of the first character after "<<<", 0 if
+ * the previous word ends with "<<<", or -1 if it is no here-string word.
+ */
+static int	herestring_start(char **list, int index)
+{
+	char	*op;
+	int		len;
+
+	if (index > 0)
+	{
+		len = ft_strlen(list[index - 1]);
+		if (len >= 3 && !ft_strcmp(list[index - 1] + len - 3, "<<<"))
+			return (0);
+	}
+	op = ft_strnstr(list[index], "<<<", ft_strlen(list[index]));
+	if (!op)
+		return (-1);
+	return (op - list[index] + 3);
+}
+
+/**
+ * @brief Copies a part of a word between double quotes.
+ * 
+ * @param s The word.
+ * @param start Index of the first character copied.
+ * @param end Index just past the last one.
+ * 
+ * @return The quoted copy, or NULL on allocation error.
+ */
+static char	*herestring_dquote(char *s, int start, int end)
+{
+	char	*text;
+
+	text = malloc(end - start + 3);
+	if (!text)
+		return (NULL);
+	text[0] = '"';
+	ft_memcpy(text + 1, s + start, end - start);
+	text[end - start + 1] = '"';
+	text[end - start + 2] = '\0';
+	return (text);
+}
+
+/**
+ * @brief Finds the end of an unquoted expansion.
+ * 
+ * @param s The word.
+ * @param i Index of the '$'.
+ * 
+ * @return The index just past the expansion, i if there is none there, or
+ * -1 if it is not closed.
+ */
+static int	herestring_expansion(char *s, int i)
+{
+	if (bracket_start(s, i))
+		return (subst_end(s, i));
+	if (is_special_param(s[i + 1]) || ft_isalpha(s[i + 1]) || s[i + 1] == '_')
+		return (get_end_position(s, i));
+	return (i);
+}
+
+/**
+ * @brief Keeps the expansions of a here-string word from being split.
+ * 
+ * A here-string is fed to the command as a single word, however many
+ * blanks its expansions hold. The unquoted expansions of the word after
+ * "<<<" are put between double quotes before the word is expanded, like
+ * a redirection target is kept out of filename expansion.
+ * 
+ * @param list The raw words of the line.
+ * @param index Index of the word, replaced when it changes.
+ */
+void	herestring_quote(char **list, int index)
+{
+	char	*s;
+	int		end;
+	int		i;
+
+	i = herestring_start(list, index);
+	while (i >= 0 && list[index][i])
+	{
+		s = list[index];
+		end = i + 1;
+		if (s[i] == '\'' || s[i] == '"')
+			end = quoted_end(s, i);
+		else if (s[i] == '$')
+			end = herestring_expansion(s, i);
+		if (end > i + 1 && s[i] == '$')
+			end = word_splice(&list[index], i, end,
+					herestring_dquote(s, i, end));
+		else if (end == i)
+			end++;
+		i = end;
+	}
+}
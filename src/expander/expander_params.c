@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_params.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:55:36 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:18:39 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Tells if a character after '$' names a special parameter.
+ * 
+ * Special parameters are one character long: $?, $#, $@, $* and the
+ * positional parameters $0 to $9.
+ * 
+ * @param c The character following the '$'.
+ * 
+ * @return 1 if it is a special parameter, 0 otherwise.
+ */
+int	is_special_param(char c)
+{
+	return (c && (c == '?' || c == '#' || c == '@' || c == '*'
+			|| ft_isdigit(c)));
+}
+
+/**
+ * @brief Returns the value of a parameter.
+ * 
+ * Special parameters are resolved here, anything else is looked up in
+ * the environment or computed if it is a dynamic variable.
+ * 
+ * @param env The environment.
+ * @param var The parameter name, without the '$'.
+ * 
+ * @return The newly allocated value, or NULL if the parameter is unset.
+ */
+char	*param_value(char **env, char *var)
+{
+	char	**params;
+	int		count;
+
+	params = shell_params()->argv;
+	count = 0;
+	if (params)
+		count = count_lines(params);
+	if (ft_strcmp(var, "?") == 0)
+		return (ft_itoa(global_status()->nbr));
+	if (ft_strcmp(var, "#") == 0)
+		return (ft_itoa(count - (count > 0)));
+	if (count > 1 && (ft_strcmp(var, "@") == 0 || ft_strcmp(var, "*") == 0))
+		return (merge_list_of_strings(params + 1, " "));
+	if (ft_isdigit(var[0]) && !var[1])
+	{
+		if (var[0] - '0' < count)
+			return (ft_strdup(params[var[0] - '0']));
+		return (NULL);
+	}
+	if (!is_special_param(var[0]))
+		return (dynamic_value(env, var));
+	return (NULL);
+}
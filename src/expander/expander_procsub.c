@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_procsub.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:10:55 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:13:46 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Returns the process substitutions of the commands being run.
+ * 
+ * Each one is the shell end of a pipe and the process at the other end.
+ * They are kept as a stack, so a command only ends its own.
+ * 
+ * @return The process substitutions.
+ */
+t_procsubs	*proc_substs(void)
+{
+	static t_procsubs	subs;
+
+	return (&subs);
+}
+
+/**
+ * @brief Runs the command of a process substitution in the child process.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param text The command.
+ * @param fd The pipe, and the standard descriptor the child gets its end
+ * as. That end is fd[fd[2]], as fd[1] is the write end.
+ */
+static void	procsub_child(t_tools *tools, char *text, int *fd)
+{
+	t_procsubs	*subs;
+	int			i;
+
+	subs = proc_substs();
+	i = 0;
+	while (i < subs->count)
+		close(subs->fd[i++]);
+	subs->count = 0;
+	close(fd[!fd[2]]);
+	dup2(fd[fd[2]], fd[2]);
+	close(fd[fd[2]]);
+	builtin_output()->capture = (t_capture){0, NULL, 0, 0};
+	std_rebase(tools);
+	compound_line(tools, text);
+	free(text);
+	free_and_exit(tools, global_status()->nbr);
+}
+
+/**
+ * @brief Starts the process of a process substitution.
+ * 
+ * The shell end of the pipe is kept open until procsub_end(), so it is
+ * left alone when the descriptors leaked by a command are closed.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param text The command, or NULL on allocation error. It is freed.
+ * @param fd The pipe, as for procsub_child().
+ * 
+ * @return The process id, or -1 on error, in which case the pipe is closed.
+ */
+static pid_t	procsub_spawn(t_tools *tools, char *text, int *fd)
+{
+	pid_t	pid;
+
+	pid = -1;
+	output_flush(NULL, 0);
+	if (text)
+		pid = fork();
+	if (pid == 0)
+		procsub_child(tools, text, fd);
+	free(text);
+	close(fd[fd[2]]);
+	if (pid < 0)
+		close(fd[!fd[2]]);
+	if (pid < 0 && text)
+		perror("minishell: fork");
+	if (pid > 0 && fd[!fd[2]] < MAX_FDS)
+		tools->exec_fds[fd[!fd[2]]] = 1;
+	return (pid);
+}
+
+/**
+ * @brief Replaces a process substitution of a word by the name of a pipe.
+ * 
+ * The command of "<(...)" writes to the pipe and that of ">(...)" reads
+ * from it. The word gets the /dev/fd name of the shell end, which the
+ * command and its redirections open like any file.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param word The word, replaced on success.
+ * @param i Index of the '<' or '>'.
+ * 
+ * @return The index just past the name in the new word, or -1 on error.
+ */
+int	expand_procsub(t_tools *tools, char **word, int i)
+{
+	t_procsubs	*subs;
+	char		num[ARITH_NUMBER];
+	int			fd[3];
+	int			end;
+	pid_t		pid;
+
+	subs = proc_substs();
+	end = subst_end(*word, i);
+	if (end < 0)
+		return (i + 1);
+	if (subs->count >= MAX_PROC_SUBSTS || pipe(fd) < 0)
+		return (-1);
+	fd[2] = STDIN_FILENO;
+	if ((*word)[i] == '<')
+		fd[2] = STDOUT_FILENO;
+	pid = procsub_spawn(tools, ft_substr(*word, i + 2, end - i - 3), fd);
+	if (pid < 0)
+		return (-1);
+	subs->fd[subs->count] = fd[!fd[2]];
+	subs->pid[subs->count++] = pid;
+	return (word_splice(word, i, end,
+			ft_strjoin("/dev/fd/", arith_lltoa(fd[!fd[2]], num))));
+}
+
+/**
+ * @brief Ends the process substitutions started after a mark.
+ * 
+ * The shell end of each pipe is closed first, which gives a reader its
+ * end of file and a writer that is still going a broken pipe, and then
+ * the process is waited for. Its status is not the one of the command.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param mark The number of process substitutions to keep.
+ */
+void	procsub_end(t_tools *tools, int mark)
+{
+	t_procsubs	*subs;
+	int			fd;
+
+	subs = proc_substs();
+	while (subs->count > mark)
+	{
+		subs->count--;
+		fd = subs->fd[subs->count];
+		close(fd);
+		if (fd < MAX_FDS)
+			tools->exec_fds[fd] = 0;
+		waitpid(subs->pid[subs->count], NULL, 0);
+	}
+}
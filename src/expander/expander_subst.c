@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_subst.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:03:15 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:27:39 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Runs a command substitution inside the shell.
+ * 
+ * The builtin output buffer collects what the command prints, so there is
+ * no fork, no pipe and no read.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param text The command.
+ * @param len Where the length of the output is stored.
+ * 
+ * @return The output, or NULL on allocation error.
+ */
+static char	*subst_builtin(t_tools *tools, char *text, size_t *len)
+{
+	t_capture	saved;
+	t_lexer		*lexer;
+	int			pipes;
+
+	lexer = tools->lexer;
+	pipes = tools->pipes;
+	capture_begin(&saved);
+	compound_line(tools, text);
+	tools->lexer = lexer;
+	tools->pipes = pipes;
+	return (capture_end(&saved, len));
+}
+
+/**
+ * @brief Runs a command substitution in the child process.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param text The command.
+ * @param fd The pipe to the shell.
+ */
+static void	subst_child(t_tools *tools, char *text, int *fd)
+{
+	close(fd[0]);
+	dup2(fd[1], STDOUT_FILENO);
+	close(fd[1]);
+	builtin_output()->capture = (t_capture){0, NULL, 0, 0};
+	std_rebase(tools);
+	compound_line(tools, text);
+	free_and_exit(tools, global_status()->nbr);
+}
+
+/**
+ * @brief Runs a command substitution in a child and reads its output.
+ * 
+ * The output is read to the end in one growing buffer, with reads as
+ * large as the free space in it.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param text The command.
+ * @param len Where the length of the output is stored.
+ * 
+ * @return The output, or NULL on error.
+ */
+static char	*subst_fork(t_tools *tools, char *text, size_t *len)
+{
+	int		fd[2];
+	pid_t	pid;
+	int		status;
+	char	*out;
+
+	if (pipe(fd) < 0)
+		return (NULL);
+	output_flush(NULL, 0);
+	pid = fork();
+	if (pid == 0)
+		subst_child(tools, text, fd);
+	close(fd[1]);
+	out = NULL;
+	if (pid > 0)
+		out = read_fd(fd[0], len);
+	close(fd[0]);
+	if (pid > 0 && waitpid(pid, &status, 0) == pid)
+		get_status(&status);
+	if (pid < 0)
+		perror("minishell: fork");
+	return (out);
+}
+
+/**
+ * @brief Runs the command of a command substitution.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param text The command.
+ * 
+ * @return The output, without its trailing newlines, or NULL on error.
+ */
+char	*subst_run(t_tools *tools, char *text)
+{
+	char	*out;
+	size_t	len;
+
+	if (subst_pure(text))
+		out = subst_builtin(tools, text, &len);
+	else
+		out = subst_fork(tools, text, &len);
+	while (out && len > 0 && out[len - 1] == '\n')
+		out[--len] = '\0';
+	return (out);
+}
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_subst_pure.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 02:25:22 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:25:22 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Tells whether the arguments of a command substitution leave the
+ * shell as it was.
+ * 
+ * "printf -v" assigns a variable. So can an arithmetic expansion, a
+ * nested command substitution or a "${name=word}" expansion, and RANDOM
+ * and BASHPID must see a process of their own. Any of these sends the
+ * command to a child, as a subshell would.
+ * 
+ * @param text The command.
+ * @param i Index just past the command name.
+ * @param printf 1 if the command is printf.
+ * 
+ * @return 1 if they do, 0 otherwise.
+ */
+static int	subst_safe(char *text, int i, int printf)
+{
+	char	*brace;
+	int		end;
+
+	while (text[i] == ' ' || text[i] == '\t')
+		i++;
+	if ((printf && text[i] == '-' && text[i + 1] == 'v')
+		|| ft_strnstr(text, "$(", ft_strlen(text)) || ft_strchr(text, '`')
+		|| ft_strnstr(text, "RANDOM", ft_strlen(text))
+		|| ft_strnstr(text, "BASHPID", ft_strlen(text)))
+		return (0);
+	brace = ft_strnstr(text, "${", ft_strlen(text));
+	while (brace)
+	{
+		end = subst_end(brace, 0);
+		if (end < 0 || ft_memchr(brace, '=', end))
+			return (0);
+		brace = ft_strnstr(brace + end, "${", ft_strlen(brace + end));
+	}
+	return (1);
+}
+
+/**
+ * @brief Tells whether a command substitution can run inside the shell.
+ * 
+ * That is a single echo, printf or pwd command, with no redirection,
+ * pipe or list, whose arguments change nothing in the shell. Those
+ * builtins only print through the builtin output buffer. A function or
+ * an alias by that name could do anything, so it does not count.
+ * 
+ * @param text The command.
+ * 
+ * @return 1 if it can, 0 otherwise.
+ */
+int	subst_pure(char *text)
+{
+	char	*name;
+	int		pure;
+	int		i;
+
+	i = 0;
+	while (text[i] == ' ' || text[i] == '\t')
+		i++;
+	name = ft_substr(text, i, ctl_word_end(text, i) - i);
+	pure = name && (!ft_strcmp(name, "echo") || !ft_strcmp(name, "printf")
+			|| !ft_strcmp(name, "pwd")) && !hash_get(shell_functions(), name)
+		&& !hash_get(shell_aliases(), name)
+		&& subst_safe(text, i + ft_strlen(name), !ft_strcmp(name, "printf"));
+	free(name);
+	while (pure && text[i])
+	{
+		i = ctl_word_end(text, i);
+		if (i < 0 || (text[i] && text[i] != ' ' && text[i] != '\t'))
+			pure = 0;
+		else if (text[i])
+			i++;
+	}
+	return (pure);
+}
@@ -0,0 +1,194 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_subst_utils.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:03:15 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Writes one character of a command substitution output.
+ * 
+ * @param out The quoted output being built.
+ * @param j The length of out.
+ * @param c The character.
+ * @param quote '"' if the substitution is inside double quotes, else 0.
+ * 
+ * @return The new length of out.
+ */
+static size_t	quote_char(char *out, size_t j, char c, char quote)
+{
+	if (quote && c == '\'')
+		j += ft_strlcpy(out + j, "'\"'\"'", 6);
+	else if (quote)
+		out[j++] = c;
+	else if (ft_isspace(c) && (!j || out[j - 1] != ' '))
+		out[j++] = ' ';
+	else if (c == '\'')
+		j += ft_strlcpy(out + j, "\"'\"", 4);
+	else if (ft_strchr(SUBST_QUOTED, c))
+	{
+		out[j++] = '\'';
+		out[j++] = c;
+		out[j++] = '\'';
+	}
+	else if (!ft_isspace(c))
+		out[j++] = c;
+	return (j);
+}
+
+/**
+ * @brief Quotes the output of a command substitution, or any text an
+ * expansion inserts in a word.
+ * 
+ * The output must come out of variable expansion, operator splitting and
+ * quote removal as it is. Inside double quotes, these are closed around
+ * the output put in single quotes. Unquoted, each run of blanks becomes
+ * one space so that the output is split into words, and the characters
+ * the shell would act on are quoted one by one, which leaves the glob
+ * characters working.
+ * 
+ * @param s The output.
+ * @param quote '"' if the substitution is inside double quotes, else 0.
+ * 
+ * @return The quoted output, or NULL on allocation error.
+ */
+char	*subst_quote(char *s, char quote)
+{
+	char	*out;
+	size_t	j;
+
+	out = malloc(ft_strlen(s) * 5 + 5);
+	if (!out)
+		return (NULL);
+	j = 0;
+	if (quote)
+		j = ft_strlcpy(out, "\"'", 3);
+	while (*s)
+		j = quote_char(out, j, *s++, quote);
+	if (quote)
+		j += ft_strlcpy(out + j, "'\"", 3);
+	out[j] = '\0';
+	return (out);
+}
+
+/**
+ * @brief Replaces a part of a word by a text.
+ * 
+ * @param word The word, replaced on success.
+ * @param start Index of the first character replaced.
+ * @param end Index just past the last character replaced.
+ * @param text The new text, or NULL on allocation error. It is freed.
+ * 
+ * @return The index just past the text in the new word, or -1 on error.
+ */
+int	word_splice(char **word, int start, int end, char *text)
+{
+	char	*out;
+	int		pos;
+
+	if (!text)
+		return (-1);
+	out = append_len(ft_substr(*word, 0, start), text, ft_strlen(text));
+	free(text);
+	if (!out)
+		return (-1);
+	pos = ft_strlen(out);
+	out = append_len(out, *word + end, ft_strlen(*word + end));
+	if (!out)
+		return (-1);
+	free(*word);
+	*word = out;
+	return (pos);
+}
+
+/**
+ * @brief Replaces a command substitution of a word by its output.
+ * 
+ * Both the $(...) and the backquoted forms are run as a command line of
+ * their own. A "${...}" expansion is handed over to expand_brace().
+ * 
+ * @param tools The tools struct.
+ * @param word The word, replaced on success.
+ * @param i Index of the '$' or of the opening backquote.
+ * @param quote '"' if the substitution is inside double quotes, else 0.
+ * 
+ * @return The index just past the output in the new word, or -1 on error.
+ */
+int	expand_command(t_tools *tools, char **word, int i, char quote)
+{
+	char	*text;
+	char	*out;
+	int		skip;
+	int		end;
+
+	if ((*word)[i] == '$' && (*word)[i + 1] == '{')
+		return (expand_brace(tools, word, i, quote));
+	skip = 1 + ((*word)[i] == '$');
+	if (skip == 2)
+		end = subst_end(*word, i);
+	else
+		end = quoted_end(*word, i);
+	if (end < 0)
+		return (i + 1);
+	text = ft_substr(*word, i + skip, end - i - skip - 1);
+	out = NULL;
+	if (text)
+		out = subst_run(tools, text);
+	free(text);
+	if (!out)
+		return (-1);
+	text = subst_quote(out, quote);
+	free(out);
+	return (word_splice(word, i, end, text));
+}
+
+/**
+ * @brief Replaces the arithmetic expansions, "${...}" expansions, command
+ * substitutions and process substitutions of a word.
+ * 
+ * Single-quoted text is left alone, and so is the text just inserted. On
+ * error the word is kept, the status is set to 1 and the command is not
+ * run, as in bash.
+ * 
+ * @param tools The tools struct.
+ * @param word The word.
+ * @param procs 0 for the text of an arithmetic expansion, where "<(" is
+ * a comparison, 1 otherwise.
+ * 
+ * @return 1 on success, 0 on error.
+ */
+int	expand_substs(t_tools *tools, char **word, int procs)
+{
+	char	quote;
+	char	c;
+	int		i;
+
+	quote = 0;
+	i = 0;
+	while (i >= 0 && (*word)[i])
+	{
+		c = (*word)[i];
+		if ((c == '\'' || c == '"') && (!quote || quote == c))
+			quote ^= c;
+		if (quote != '\'' && !ft_strncmp(*word + i, "$((", 3))
+			i = expand_arith(tools, word, i);
+		else if (quote != '\'' && (c == '`' || (c == '$'
+					&& bracket_start(*word, i))))
+			i = expand_command(tools, word, i, quote);
+		else if (procs && !quote && procsub_start(*word, i))
+			i = expand_procsub(tools, word, i);
+		else
+			i++;
+	}
+	if (i >= 0)
+		return (1);
+	global_status()->nbr = 1;
+	return (0);
+}
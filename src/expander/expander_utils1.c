@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/27 10:04:57 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/18 23:57:04 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -27,24 +27,8 @@
  */
 int	is_expandable(char **list, int *index)
 {
-	char	*tmp;
-	char	*line;
-	int		pos;
-
 	if (ft_strchr(list[*index], '$'))
-	{
-		pos = find_char_position(list[*index], '$');
-		if (ft_isdigit(list[*index][pos + 1]))
-		{
-			tmp = ft_strdup(list[*index]);
-			free(list[*index]);
-			line = ft_substr(tmp, pos + 2, (ft_strlen(tmp - pos + 1)));
-			list[*index] = ft_strdup(line);
-			free(tmp);
-			free(line);
-		}
 		return (1);
-	}
 	if (ft_strcmp(list[*index], "<<") == 0)
 	{
 		(*index)++;
@@ -128,7 +112,7 @@ int	get_end_position(char *str, int position)
 {
 	int	end;
 
-	if (str[position + 1] == '?')
+	if (is_special_param(str[position + 1]))
 		end = position + 2;
 	else if ((str[position + 1] == '\'' && str[position + 2] == '\\'
 			&& str[position + 4] == '\''))
@@ -166,10 +150,7 @@ char	*add_prefix_and_suffix(char *str, char **env, int position, int end)
 
 	prefix = ft_substr(str, 0, position);
 	var = ft_substr(str, position + 1, end - position - 1);
-	if (ft_strncmp(var, "?", 1) == 0)
-		value = ft_itoa(global_status()->nbr);
-	else
-		value = get_var_from_env(env, var);
+	value = param_value(env, var);
 	suffix = ft_substr(str, end, ft_strlen(str) - end);
 	if (prefix[0] == '\"' && str[1] == '$')
 	{
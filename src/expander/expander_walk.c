@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_walk.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:46:52 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:48:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Returns the number of threads a walk uses.
+ * 
+ * GLOB_THREADS sets it, and it defaults to the number of online CPUs.
+ * 
+ * @return The number of threads, at least 1 and at most GLOB_MAX_THREADS.
+ */
+static int	walk_threads(void)
+{
+	char	*value;
+	long	threads;
+
+	threads = 0;
+	value = get_var_from_env(glob_options()->env, "GLOB_THREADS");
+	if (value)
+		threads = ft_atol(value);
+	free(value);
+	if (threads <= 0)
+		threads = sysconf(_SC_NPROCESSORS_ONLN);
+	if (threads < 1)
+		threads = 1;
+	if (threads > GLOB_MAX_THREADS)
+		threads = GLOB_MAX_THREADS;
+	return ((int)threads);
+}
+
+/**
+ * @brief Prepares a walk of the directories below a path.
+ * 
+ * @param walk The walk.
+ * @param prefix The path. An empty prefix is the working directory.
+ * @param dir_only 1 to only record directories.
+ * 
+ * @return 1 on success, 0 on error.
+ */
+static int	walk_init(t_walk *walk, char *prefix, int dir_only)
+{
+	int	i;
+
+	ft_bzero(walk, sizeof(t_walk));
+	walk->prefix = prefix;
+	walk->dir_only = dir_only;
+	walk->threads = walk_threads();
+	walk->queues = ft_calloc(walk->threads, sizeof(t_wqueue));
+	walk->found = ft_calloc(walk->threads, sizeof(t_glob));
+	if (*prefix)
+		walk->root_fd = open(prefix, WALK_OPEN);
+	else
+		walk->root_fd = open(".", WALK_OPEN);
+	pthread_mutex_init(&walk->lock, NULL);
+	i = -1;
+	while (walk->queues && ++i < walk->threads)
+		pthread_mutex_init(&walk->queues[i].lock, NULL);
+	return (walk->queues && walk->found && walk->root_fd != -1);
+}
+
+/**
+ * @brief Runs the workers of a walk until every directory is read.
+ * 
+ * The calling thread is the first worker, so a walk with one thread
+ * starts none.
+ * 
+ * @param walk The walk.
+ */
+static void	walk_run(t_walk *walk)
+{
+	t_worker	workers[GLOB_MAX_THREADS];
+	int			i;
+
+	i = -1;
+	while (++i < walk->threads)
+	{
+		workers[i] = (t_worker){walk, 0, i, -1};
+		if (i > 0 && pthread_create(&workers[i].thread, NULL, walk_worker,
+				&workers[i]))
+			workers[i].id = -1;
+	}
+	walk_worker(&workers[0]);
+	while (--i > 0)
+		if (workers[i].id != -1)
+			pthread_join(workers[i].thread, NULL);
+}
+
+/**
+ * @brief Moves the paths each worker found to a list and ends a walk.
+ * 
+ * @param walk The walk.
+ * @param out The list.
+ */
+static void	walk_merge(t_walk *walk, t_glob *out)
+{
+	int	i;
+	int	j;
+
+	i = -1;
+	while (walk->found && ++i < walk->threads)
+	{
+		j = -1;
+		while (++j < walk->found[i].count)
+			glob_add(out, walk->found[i].paths[j]);
+		free(walk->found[i].paths);
+	}
+	i = -1;
+	while (walk->queues && ++i < walk->threads)
+	{
+		glob_free(&walk->queues[i].items);
+		pthread_mutex_destroy(&walk->queues[i].lock);
+	}
+	pthread_mutex_destroy(&walk->lock);
+	free(walk->found);
+	free(walk->queues);
+	if (walk->root_fd != -1)
+		close(walk->root_fd);
+}
+
+/**
+ * @brief Matches "**" against the directories below a path.
+ * 
+ * Followed by more components, "**" matches the path itself and every
+ * directory below it. As the last component, it matches every file and
+ * directory below the path. The tree is read in parallel, and the caller
+ * sorts the matches.
+ * 
+ * @param out The list the matches are added to.
+ * @param prefix The path.
+ * @param step The component.
+ */
+void	glob_star(t_glob *out, char *prefix, t_gstep *step)
+{
+	t_walk	walk;
+
+	if (step->dir_only)
+		glob_add(out, ft_strdup(prefix));
+	else if (*prefix)
+		glob_add(out, glob_join(prefix, ""));
+	if (walk_init(&walk, prefix, step->dir_only)
+		&& walk_push(&walk, 0, ft_strdup("")))
+		walk_run(&walk);
+	walk_merge(&walk, out);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_walk_utils1.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:46:52 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:48:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Pushes a directory onto the queue of a worker.
+ * 
+ * The directory is counted as pending before it becomes visible, so the
+ * walk cannot end while it waits in a queue.
+ * 
+ * @param walk The walk.
+ * @param id The worker that owns the queue.
+ * @param path The directory, relative to the root. The queue takes it
+ * over; NULL is ignored.
+ * 
+ * @return 1 on success, 0 on error.
+ */
+int	walk_push(t_walk *walk, int id, char *path)
+{
+	t_wqueue	*queue;
+	int			pushed;
+
+	queue = &walk->queues[id];
+	pthread_mutex_lock(&queue->lock);
+	walk_count(walk, 1);
+	pushed = glob_add(&queue->items, path);
+	if (!pushed)
+		walk_count(walk, -1);
+	pthread_mutex_unlock(&queue->lock);
+	return (pushed);
+}
+
+/**
+ * @brief Takes a directory out of a queue.
+ * 
+ * The owner takes the newest directory, which is likely still cached,
+ * while thieves take the oldest, which likely holds the largest subtree.
+ * 
+ * @param queue The queue.
+ * @param own 1 if the caller owns the queue.
+ * 
+ * @return The directory, or NULL if the queue is empty.
+ */
+static char	*walk_take(t_wqueue *queue, int own)
+{
+	char	*path;
+
+	path = NULL;
+	pthread_mutex_lock(&queue->lock);
+	if (queue->items.count > queue->head && own)
+		path = queue->items.paths[--queue->items.count];
+	else if (queue->items.count > queue->head)
+		path = queue->items.paths[queue->head++];
+	if (queue->head == queue->items.count)
+	{
+		queue->head = 0;
+		queue->items.count = 0;
+	}
+	pthread_mutex_unlock(&queue->lock);
+	return (path);
+}
+
+/**
+ * @brief Finds the next directory for a worker to read.
+ * 
+ * A worker with an empty queue steals from the others in turn.
+ * 
+ * @param walk The walk.
+ * @param id The worker.
+ * 
+ * @return The directory, or NULL if every queue is empty.
+ */
+char	*walk_pop(t_walk *walk, int id)
+{
+	char	*path;
+	int		i;
+
+	path = walk_take(&walk->queues[id], 1);
+	i = 0;
+	while (!path && ++i < walk->threads)
+		path = walk_take(&walk->queues[(id + i) % walk->threads], 0);
+	return (path);
+}
+
+/**
+ * @brief Updates the number of directories queued or being read.
+ * 
+ * @param walk The walk.
+ * @param delta The change, 0 to only read the number.
+ * 
+ * @return The number after the change. The walk is over at 0.
+ */
+int	walk_count(t_walk *walk, int delta)
+{
+	int	pending;
+
+	pthread_mutex_lock(&walk->lock);
+	walk->pending += delta;
+	pending = walk->pending;
+	pthread_mutex_unlock(&walk->lock);
+	return (pending);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_walk_utils2.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:46:53 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:48:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/expander.h"
+
+/**
+ * @brief Records an entry of a directory and queues it if it is one.
+ * 
+ * Hidden entries are left out, and symbolic links are never followed.
+ * 
+ * @param worker The worker reading the directory.
+ * @param path The directory, relative to the root.
+ * @param entry The entry.
+ */
+static void	walk_entry(t_worker *worker, char *path, t_dirent64 *entry)
+{
+	struct stat	st;
+	char		*rel;
+	int			dir;
+
+	if (entry->d_name[0] == '.')
+		return ;
+	dir = (entry->d_type == DT_DIR);
+	if (entry->d_type == DT_UNKNOWN && !fstatat(worker->fd, entry->d_name,
+			&st, AT_SYMLINK_NOFOLLOW))
+		dir = S_ISDIR(st.st_mode);
+	if (!dir && worker->walk->dir_only)
+		return ;
+	rel = glob_join(path, entry->d_name);
+	if (!rel)
+		return ;
+	if (dir)
+		walk_push(worker->walk, worker->id, ft_strdup(rel));
+	glob_add(&worker->walk->found[worker->id],
+		glob_join(worker->walk->prefix, rel));
+	free(rel);
+}
+
+/**
+ * @brief Reads a directory with getdents64().
+ * 
+ * The directory is opened relative to the root of the walk, and its
+ * entries are read in large batches without going through the stdio-like
+ * buffering of readdir().
+ * 
+ * @param worker The worker.
+ * @param path The directory, relative to the root. Empty for the root.
+ */
+void	walk_dir(t_worker *worker, char *path)
+{
+	unsigned long long	buffer[WALK_BUFFER / sizeof(unsigned long long)];
+	t_dirent64			*entry;
+	long				n;
+	long				pos;
+
+	if (*path)
+		worker->fd = openat(worker->walk->root_fd, path, WALK_OPEN);
+	else
+		worker->fd = openat(worker->walk->root_fd, ".", WALK_OPEN);
+	if (worker->fd == -1)
+		return ;
+	n = syscall(SYS_getdents64, worker->fd, buffer, sizeof(buffer));
+	while (n > 0)
+	{
+		pos = 0;
+		while (pos < n)
+		{
+			entry = (t_dirent64 *)((char *)buffer + pos);
+			walk_entry(worker, path, entry);
+			pos += entry->d_reclen;
+		}
+		n = syscall(SYS_getdents64, worker->fd, buffer, sizeof(buffer));
+	}
+	close(worker->fd);
+}
+
+/**
+ * @brief Runs a worker until no directory is left to read.
+ * 
+ * @param arg The worker.
+ * 
+ * @return NULL.
+ */
+void	*walk_worker(void *arg)
+{
+	t_worker	*worker;
+	char		*path;
+
+	worker = arg;
+	while (walk_count(worker->walk, 0))
+	{
+		path = walk_pop(worker->walk, worker->id);
+		if (!path)
+		{
+			sched_yield();
+			continue ;
+		}
+		walk_dir(worker, path);
+		free(path);
+		walk_count(worker->walk, -1);
+	}
+	return (NULL);
+}
@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 14:27:25 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:00:51 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,20 +25,22 @@
  * @param start The start index of the word segment within 'word'.
  * @param end The end index of the word segment within 'word' (exclusive).
  * @param lexer Pointer to the pointer to the head of the lexer list.
+ * 
+ * @return The new node, or NULL on allocation error.
  */
-void	add_word_to_node(char *word, t_lexer **lexer)
+t_lexer	*add_word_to_node(char *word, t_lexer **lexer)
 {
 	t_lexer	*node;
 	t_lexer	*last;
 
 	node = ft_calloc(1, sizeof(t_lexer));
 	if (!node)
-		return ;
+		return (NULL);
 	node->words = ft_strdup(word);
 	if (!node->words)
 	{
 		free(node);
-		return ;
+		return (NULL);
 	}
 	node->token = '\0';
 	if (*lexer)
@@ -50,9 +52,8 @@ void	add_word_to_node(char *word, t_lexer **lexer)
 	}
 	else
 		node->index = 0;
-	node->next = NULL;
-	node->pre = NULL;
 	ft_lstaddback_lexer(lexer, node);
+	return (node);
 }
 
 /**
@@ -148,7 +149,7 @@ int	lex_line(char	**line_split_quotes, t_tools *tools)
 	if (!line_split_quotes)
 		return (0);
 	check_special_chars(line_split_quotes);
-	new_line = expander(tools->env, line_split_quotes, tools);
+	new_line = expander(line_split_quotes, tools);
 	if (!new_line)
 		return (0);
 	line_split_quotes = lexer_split(new_line, 1);
@@ -160,6 +161,7 @@ int	lex_line(char	**line_split_quotes, t_tools *tools)
 		free_list(line_split_quotes);
 		return (0);
 	}
+	glob_options()->env = tools->env;
 	add_line_to_lexer_struct(line_split_quotes, &tools->lexer);
 	free_list(line_split_quotes);
 	return (1);
@@ -168,27 +170,25 @@ int	lex_line(char	**line_split_quotes, t_tools *tools)
 /**
  * @brief Lexically analyzes a line and adds it to the lexer structure.
  * 
- * This function performs lexical analysis on the input
- * 'line' by splitting it into words and tokens,
- * expanding environment variables, and adding the resulting segments
- * to the lexer structure.
+ * This function performs lexical analysis on the words of a line,
+ * expanding environment variables, splitting them into words and tokens
+ * and adding the resulting segments to the lexer structure. The words are
+ * split by the caller, so a command that runs many times is split once.
  * 
- * @param line The input line to lexically analyze.
- * @param lexer Pointer to the pointer to the head of the lexer list.
- * @param envp The environment variables array for expansion.
+ * @param line_split_quotes The words of the line, as split by lexer_split()
+ * without expansion. They are freed.
+ * @param tools A pointer to the tools structure.
  * 
  * @return Returns 1 on success.
  */
-int	lexer(char *line, t_tools *tools)
+int	lexer(char **line_split_quotes, t_tools *tools)
 {
-	char	**line_split_quotes;
-
 	tools->lexer = NULL;
 	tools->pipes = 0;
-	line_split_quotes = lexer_split(line, 0);
 	if (!lex_line(line_split_quotes, tools))
 	{
-		free_list(line_split_quotes);
+		if (line_split_quotes)
+			free_list(line_split_quotes);
 		return (0);
 	}
 	free_list(line_split_quotes);
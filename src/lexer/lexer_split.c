@@ -6,7 +6,7 @@
 /*   By: ftomazc < ftomaz-c@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/23 00:00:05 by ftomazc          ###   ########.fr       */
+/*   Updated: 2026/10/19 02:49:07 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -30,39 +30,27 @@ void	syntax_err(char token)
 }
 
 /**
- * @brief Handles characters within a string, 
- * updating the index and start position.
+ * @brief Handles characters within a string, updating the index.
  * 
  * This function handles characters within a string, 
- * updating the index and start position pointers accordingly.
+ * updating the index pointer accordingly.
  * It advances the index until encountering a space, 
- * double quote, or single quote character.
- * If a quote character is found, it adjusts the start
- *  position to exclude the quote character itself and its contents.
+ * double quote, or single quote character, skipping over "$(...)" and
+ * "$((...))" as a whole. If a quote character is found, the quoted part
+ * belongs to the same word. create_split() keeps track of where that word
+ * starts as it goes, so it is never looked for backwards.
  * 
  * @param s     Pointer to the string to handle.
  * @param i     Pointer to the current index within the string.
- * @param start Pointer to the start position within the string.
+ * @param flag  Flag passed on to ft_isspace_special().
  */
-void	handle_characters(char *s, int *i, int *start, int flag)
+void	handle_characters(char *s, int *i, int flag)
 {
-	int	tmp;
-
 	while (s[*i] && (!ft_isspace_special(s[*i], flag)
 			&& s[*i] != '\"' && s[*i] != '\''))
-		(*i)++;
+		*i = word_skip(s, *i);
 	if (s[*i] == '\"' || s[*i] == '\'')
-	{
-		if (s[*i] && s[*i - 1] && s[*i - 1] != ' ')
-		{
-			tmp = (*i);
-			while (*i >= 0 && s[*i] && s[*i] != ' ')
-				(*i)--;
-			*start = ++(*i);
-			(*i) = tmp;
-		}
 		*i = paired_quote(s, *i + 1, s[*i], flag);
-	}
 }
 
 /**
@@ -99,7 +87,7 @@ char	**create_split(char *s, char **split, int nwords, int flag)
 		if (s[i] == '\"' || s[i] == '\'' || ft_isspace_special(s[i], flag))
 			handle_white_spaces_and_quotes(s, &i, &start, flag);
 		if (s[i] && s[i] != ' ' && s[i] != '\"' && s[i] != '\'')
-			handle_characters(s, &i, &start, flag);
+			handle_characters(s, &i, flag);
 		split[j] = word_alloc(s, start, i);
 		i++;
 		j++;
@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/19 20:45:36 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -49,7 +49,10 @@ int	paired_quote(char *str, int i, char ch, int flag)
 		}
 		else if (ft_isspace_special(str[i], flag) && pair == 1)
 			break ;
-		i++;
+		if (pair || ch == '\"')
+			i = word_skip(str, i);
+		else
+			i++;
 	}
 	return (i);
 }
@@ -133,19 +136,15 @@ int	count_words_and_quotes(char *s, size_t size, int flag)
 	{
 		while (i < size && ft_isspace_special(s[i], flag))
 			i++;
-		if (i < size && s[i] && (s[i] == '\"' || s[i] == '\''))
-		{
-			word++;
-			i = paired_quote(s, i + 1, s[i], flag) + 1;
-		}
-		else
+		word++;
+		if (i >= size || (s[i] != '\"' && s[i] != '\''))
+			i = word_skip(s, i);
+		while (i < size && !ft_isspace_special(s[i], flag))
 		{
-			word++;
-			i++;
-			if (i < size && (s[i] == '\"' || s[i] == '\''))
-				i = paired_quote(s, i + 1, s[i], flag) + 1;
-			while (i < size && !ft_isspace_special(s[i], flag))
-				i++;
+			if (s[i] == '\"' || s[i] == '\'')
+				i = paired_quote(s, i + 1, s[i], flag);
+			else
+				i = word_skip(s, i);
 		}
 	}
 	return (word);
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_subst.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:59:00 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 01:38:26 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/lexer.h"
+
+/**
+ * @brief Finds the end of a quoted part of a word.
+ * 
+ * A substitution inside double quotes may hold quotes of its own.
+ * 
+ * @param s The source text.
+ * @param i Index of the opening quote or backquote.
+ * 
+ * @return The index just past the closing quote, or -1 if it is missing.
+ */
+int	quoted_end(char *s, int i)
+{
+	char	quote;
+
+	quote = s[i++];
+	while (s[i] && s[i] != quote)
+	{
+		if (quote == '"')
+			i = word_skip(s, i);
+		else
+			i++;
+	}
+	if (!s[i])
+		return (-1);
+	return (i + 1);
+}
+
+/**
+ * @brief Tells whether a process substitution starts at an index.
+ * 
+ * @param s The source text.
+ * @param i The index.
+ * 
+ * @return 1 for "<(" or ">(", 0 otherwise.
+ */
+int	procsub_start(char *s, int i)
+{
+	return ((s[i] == '<' || s[i] == '>') && s[i + 1] == '(');
+}
+
+/**
+ * @brief Tells whether a bracketed part of a word starts at an index.
+ * 
+ * That is a "$(...)" or "${...}" substitution, a process substitution or
+ * the "=(...)" list of an array assignment.
+ * 
+ * @param s The source text.
+ * @param i The index.
+ * 
+ * @return 1 if it does, 0 otherwise.
+ */
+int	bracket_start(char *s, int i)
+{
+	return ((s[i] == '$' && (s[i + 1] == '(' || s[i + 1] == '{'))
+		|| procsub_start(s, i) || (s[i] == '=' && s[i + 1] == '('));
+}
+
+/**
+ * @brief Finds the end of a bracketed part of a word, as found by
+ * bracket_start().
+ * 
+ * Nested parentheses or braces are counted and quotes are skipped, so the
+ * operators inside a command substitution do not end the word.
+ * 
+ * @param s The source text.
+ * @param i Index of the character before the opening bracket.
+ * 
+ * @return The index just past the closing bracket, or -1 if it is missing.
+ */
+int	subst_end(char *s, int i)
+{
+	char	open;
+	char	close;
+	int		depth;
+
+	open = s[++i];
+	close = '}';
+	if (open == '(')
+		close = ')';
+	depth = 0;
+	while (i >= 0 && s[i])
+	{
+		if (s[i] == '\'' || s[i] == '"' || s[i] == '`')
+		{
+			i = quoted_end(s, i);
+			continue ;
+		}
+		depth += (s[i] == open) - (s[i] == close);
+		i++;
+		if (!depth)
+			return (i);
+	}
+	return (-1);
+}
+
+/**
+ * @brief Steps over one character of a word, or over a whole substitution.
+ * 
+ * A bracketed or backquoted part of a word is kept in one piece, whatever
+ * blanks it holds. An unclosed one is
+ * stepped over a character at a time, as before.
+ * 
+ * @param s The text.
+ * @param i The index of the character.
+ * 
+ * @return The index of the next character to look at.
+ */
+int	word_skip(char *s, int i)
+{
+	int	end;
+
+	end = -1;
+	if (bracket_start(s, i))
+		end = subst_end(s, i);
+	else if (s[i] == '`')
+		end = quoted_end(s, i);
+	if (end < 0)
+		return (i + 1);
+	return (end);
+}
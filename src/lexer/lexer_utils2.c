@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42lisboa.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/19 20:52:09 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,7 +57,9 @@ char	*remove_quotes(char	*str, int i)
  * 
  * This function removes quotes from a substring of the input string,
  * adds the modified substring to a word, and frees the
- *  memory of the modified substring.
+ *  memory of the modified substring. Words that had quotes are flagged,
+ * which here-documents use to decide whether to expand their body, and so
+ * are words that assign a variable.
  * 
  * @param line_split The input string containing the substring.
  * @param start The starting index of the substring.
@@ -68,13 +70,23 @@ void	remove_quotes_add_word(char *line, int start, int j, t_lexer **lexer)
 {
 	char	*new;
 	char	*word_no_quotes;
+	t_lexer	*node;
 	int		i;
 
 	i = 0;
 	new = ft_substr(line, start, j - start);
+	if (new && glob_word(new, lexer))
+	{
+		free(new);
+		return ;
+	}
 	word_no_quotes = remove_quotes(new, i);
+	node = add_word_to_node(word_no_quotes, lexer);
+	if (node && (ft_strchr(new, '\'') || ft_strchr(new, '\"')))
+		node->quoted = 1;
+	if (node)
+		node->assign = is_assignment(new);
 	free(new);
-	add_word_to_node(word_no_quotes, lexer);
 	free(word_no_quotes);
 }
 
@@ -96,7 +108,12 @@ void	handle_quote(char *line, int *flag, int *i, char quote)
 	(*i)++;
 	*flag = -1;
 	while (line[*i] && line[*i] != quote)
-		(*i)++;
+	{
+		if (quote == '\"')
+			*i = word_skip(line, *i);
+		else
+			(*i)++;
+	}
 	if (*i < (int)ft_strlen(line))
 		*flag = 1;
 }
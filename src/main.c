@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 18:54:58 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:18:39 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,14 +57,18 @@ int	main(int argc, char **argv, char **envp)
 	t_tools	tools;
 	char	*line;
 
+	clock_gettime(CLOCK_MONOTONIC, &shell_dynamic()->start);
 	config_tools(&tools, envp);
+	setup_completion(&tools);
+	shell_params()->argv = list_dup(argv, 0, 1);
 	update_history(&tools, ".minishell_history");
 	error_check(argc, argv);
+	tools.original_stdin = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, SAVED_FD_BASE);
+	tools.original_stdout = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC,
+			SAVED_FD_BASE);
 	while (1)
 	{
 		line = NULL;
-		tools.original_stdin = dup (STDIN_FILENO);
-		tools.original_stdout = dup (STDOUT_FILENO);
 		handle_sigaction();
 		if (!isatty(STDIN_FILENO))
 			non_interactive_mode(&tools, line);
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   completion.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:50:30 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/18 23:51:41 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Tells if the word starting at start is in command position.
+ * 
+ * @param start Index of the word in rl_line_buffer.
+ * 
+ * @return 1 if the word is the first of the line or follows a '|', 0
+ * otherwise.
+ */
+static int	command_position(int start)
+{
+	int	i;
+
+	i = start - 1;
+	while (i >= 0 && ft_isspace(rl_line_buffer[i]))
+		i--;
+	return (i < 0 || rl_line_buffer[i] == '|');
+}
+
+/**
+ * @brief Finds the first name that does not sort before text.
+ * 
+ * @param names The sorted list of names.
+ * @param count Number of names.
+ * @param text The prefix being completed.
+ * 
+ * @return Index of the first name that may start with text.
+ */
+static int	lower_bound(char **names, int count, const char *text)
+{
+	int	low;
+	int	high;
+	int	mid;
+
+	low = 0;
+	high = count;
+	while (low < high)
+	{
+		mid = (low + high) / 2;
+		if (ft_strcmp(names[mid], (char *)text) < 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return (low);
+}
+
+/**
+ * @brief readline generator returning the PATH commands starting with text.
+ * 
+ * The first call brings the index up to date and binary searches the first
+ * candidate; the matches are then consecutive in the sorted list.
+ * 
+ * @param text The prefix being completed.
+ * @param state 0 on the first call for a given text.
+ * 
+ * @return The next match, allocated for readline, or NULL when done.
+ */
+static char	*command_generator(const char *text, int state)
+{
+	static int		i;
+	t_path_index	*index;
+
+	index = path_index();
+	if (!state)
+	{
+		path_index_update(index->path);
+		i = lower_bound(index->names, index->count, text);
+	}
+	if (i < index->count
+		&& !ft_strncmp(index->names[i], text, ft_strlen(text)))
+		return (ft_strdup(index->names[i++]));
+	return (NULL);
+}
+
+/**
+ * @brief Completes command names from PATH, filenames everywhere else.
+ * 
+ * @param text The word being completed.
+ * @param start Index of the word in rl_line_buffer.
+ * @param end Index of the end of the word.
+ * 
+ * @return The list of matches, or NULL to let readline complete filenames.
+ */
+static char	**command_completion(const char *text, int start, int end)
+{
+	(void)end;
+	if (!command_position(start) || ft_strchr(text, '/'))
+		return (NULL);
+	return (rl_completion_matches(text, command_generator));
+}
+
+/**
+ * @brief Hooks command name completion into readline.
+ * 
+ * The index itself is only built the first time it is needed.
+ * 
+ * @param tools Pointer to the tools structure.
+ */
+void	setup_completion(t_tools *tools)
+{
+	path_index()->path = tools->path;
+	rl_attempted_completion_function = command_completion;
+}
@@ -6,37 +6,30 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 18:59:17 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:30:11 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../includes/minishell.h"
 
 /**
- * @brief Executes the minishell.
+ * @brief Lexes, parses and executes a single simple command or pipeline.
  * 
- * This function handles the execution of the minishell. It adds the input line
- * to the history file, checks for unclosed quotes, lexes the input line,
- * parses it, and executes the parsed commands using the executor.
+ * The process substitutions of the command end with it.
  * 
- * @param tools A pointer to the tools structure containing
- * environment variables and history information.
- * @param line The input line to be executed.
- * @return None.
+ * @param tools A pointer to the tools structure.
+ * @param words The words of the command, as split by lexer_split() without
+ * expansion. They are freed.
  */
-void	minishell(t_tools *tools, char *line)
+void	run_words(t_tools *tools, char **words)
 {
-	tools->nprompts++;
-	add_history_file(tools, line, ".minishell_history");
-	if (check_unclosed_quotes(line))
+	int	mark;
+
+	mark = proc_substs()->count;
+	if (!lexer(words, tools))
+		free_lexer(&tools->lexer);
+	else if (parser(tools))
 	{
-		if (!lexer(line, tools))
-		{
-			free_lexer(&tools->lexer);
-			return ;
-		}
-		if (!parser(tools))
-			return ;
 		if (tools->lexer)
 			free_lexer(&tools->lexer);
 		if (tools->parser)
@@ -45,8 +38,44 @@ void	minishell(t_tools *tools, char *line)
 			free_parser(&tools->parser);
 		}
 	}
-	else
+	procsub_end(tools, mark);
+}
+
+/**
+ * @brief Checks a command line for unclosed quotes and runs it.
+ * 
+ * This is also how sourced files run their lines. A control structure
+ * started on the line is completed with the lines that follow.
+ * 
+ * @param tools A pointer to the tools structure.
+ * @param line The command line.
+ */
+void	execute_line(t_tools *tools, char *line)
+{
+	if (!check_unclosed_quotes(line))
+	{
 		ft_putstr_fd("minishell: input with unclosed quotes\n", STDERR_FILENO);
+		return ;
+	}
+	compound_line(tools, line);
+}
+
+/**
+ * @brief Executes the minishell.
+ * 
+ * This function handles the execution of the minishell. It adds the input line
+ * to the history file and executes it.
+ * 
+ * @param tools A pointer to the tools structure containing
+ * environment variables and history information.
+ * @param line The input line to be executed.
+ * @return None.
+ */
+void	minishell(t_tools *tools, char *line)
+{
+	tools->nprompts++;
+	add_history_file(tools, line, ".minishell_history");
+	execute_line(tools, line);
 }
 
 /**
@@ -54,39 +83,26 @@ void	minishell(t_tools *tools, char *line)
  * 
  * This function handles the execution of the minishell
  * in non-interactive mode.
- * It reads lines from standard input, trims them, executes 
- * them using the minishell,
- * and then frees the memory allocated for the lines.
+ * The whole script is read from standard input at once and split into
+ * tools->lines. tools->line_count is the index of the next line to run, so
+ * here-documents can consume the lines that follow their command.
  * 
  * @param tools A pointer to the tools structure containing environment 
  * variables and line count information.
- * @param line The input line read from standard input.
+ * @param line Unused, the script is read into a local buffer.
  * @return None.
  */
 void	non_interactive_mode(t_tools *tools, char *line)
 {
-	int		n;
-	int		i;
-	char	*tmp;
-
-	n = 0;
-	tools->lines = ft_calloc(sizeof(char **), 1024);
 	tools->nint_mode = 1;
-	line = get_next_line(0);
-	while (line)
-	{
-		tmp = ft_strtrim(line, "\n");
-		tools->lines[n] = ft_strdup(tmp);
-		n++;
-		free(line);
-		free(tmp);
-		line = get_next_line(0);
-	}
-	i = 0;
-	while (i < n)
+	line = read_fd(STDIN_FILENO, NULL);
+	if (line)
+		tools->lines = split_lines(line);
+	free(line);
+	while (tools->lines && tools->lines[tools->line_count] && !tools->exit)
 	{
 		tools->line_count++;
-		minishell(tools, tools->lines[i++]);
+		minishell(tools, tools->lines[tools->line_count - 1]);
 	}
 	tools->exit = 1;
 }
@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:39:20 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:28:44 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Splits a script into lines, keeping the empty ones.
+ * 
+ * Empty lines matter inside here-documents and for the line numbers used in
+ * error messages, so unlike ft_split() every newline starts a new entry.
+ * Newlines are replaced by terminators in place, so each line is copied
+ * without scanning the rest of the script.
+ * 
+ * @param data The whole script, null-terminated. It is modified.
+ * 
+ * @return A null-terminated list of lines without their newline, or NULL on
+ * allocation error.
+ */
+char	**split_lines(char *data)
+{
+	char	**lines;
+	char	*end;
+	int		n;
+
+	lines = ft_calloc(count_chr(data, '\n') + 2, sizeof(char *));
+	if (!lines)
+		return (NULL);
+	n = 0;
+	while (*data)
+	{
+		end = ft_strchr(data, '\n');
+		if (end)
+			*end = '\0';
+		lines[n] = ft_strdup(data);
+		if (!lines[n++])
+		{
+			free_list(lines);
+			return (NULL);
+		}
+		data += ft_strlen(lines[n - 1]) + (end != NULL);
+	}
+	return (lines);
+}
+
+/**
+ * @brief Joins a range of lines into one newline-terminated block.
+ * 
+ * The size is computed first so the block is built with a single
+ * allocation, whatever the number of lines.
+ * 
+ * @param lines The list of lines.
+ * @param start Index of the first line to join.
+ * @param end Index one past the last line to join.
+ * @param len Where the length of the block is stored.
+ * 
+ * @return The joined block, or NULL on allocation error.
+ */
+char	*join_lines(char **lines, int start, int end, size_t *len)
+{
+	char	*block;
+	size_t	size;
+	size_t	line_len;
+	int		i;
+
+	size = 0;
+	i = start;
+	while (i < end)
+		size += ft_strlen(lines[i++]) + 1;
+	block = malloc(size + 1);
+	if (!block)
+		return (NULL);
+	*len = 0;
+	while (start < end)
+	{
+		line_len = ft_strlen(lines[start]);
+		ft_memcpy(block + *len, lines[start++], line_len);
+		block[*len + line_len] = '\n';
+		*len += line_len + 1;
+	}
+	block[*len] = '\0';
+	return (block);
+}
+
+/**
+ * @brief Builds the expanded body of a here-document from script lines.
+ * 
+ * The lines are copied before being expanded: the same lines are read
+ * again when the here-document is part of a loop body.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param end Index of the delimiter line.
+ * @param len Where the length of the body is stored.
+ * 
+ * @return The body, or NULL on allocation error.
+ */
+static char	*script_body(t_tools *tools, int end, size_t *len)
+{
+	char	**lines;
+	char	*body;
+	int		n;
+	int		i;
+
+	n = end - tools->line_count;
+	lines = list_dup(tools->lines, tools->line_count, end);
+	if (!lines)
+		return (NULL);
+	i = 0;
+	while (i < n)
+	{
+		lines[i] = expand_heredoc_line(tools, lines[i]);
+		if (!lines[i])
+			break ;
+		i++;
+	}
+	body = NULL;
+	if (i == n)
+		body = join_lines(lines, 0, n, len);
+	while (i < n)
+		free(lines[++i]);
+	free_list(lines);
+	return (body);
+}
+
+/**
+ * @brief Reads a here-document body straight from the script being run.
+ * 
+ * In non-interactive mode the body is made of the lines that follow the
+ * command in tools->lines. They are consumed up to the delimiter, expanded
+ * unless the delimiter was quoted, and written with a single call.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param fd The descriptor the body is written to.
+ * @param delimiter The delimiter token of the here-document.
+ * 
+ * @return 1 on success, 0 on allocation error.
+ */
+int	script_here_doc(t_tools *tools, int fd, t_lexer *delimiter)
+{
+	char	**lines;
+	char	*body;
+	size_t	len;
+	int		end;
+
+	lines = tools->lines;
+	end = tools->line_count;
+	while (lines[end] && ft_strcmp(lines[end], delimiter->words) != 0)
+		end++;
+	if (delimiter->quoted)
+		body = join_lines(lines, tools->line_count, end, &len);
+	else
+		body = script_body(tools, end, &len);
+	if (body)
+		write(fd, body, len);
+	free(body);
+	if (!lines[end])
+		eof_sig_msg(tools, NULL, delimiter->words);
+	tools->line_count = end + (lines[end] != NULL);
+	return (body != NULL);
+}
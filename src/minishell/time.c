@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:34:32 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:30:11 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Takes the starting snapshot of a timed pipeline.
+ * 
+ * @param timer The timer to start.
+ */
+void	time_start(t_timer *timer)
+{
+	clock_gettime(CLOCK_MONOTONIC, &timer->start);
+	getrusage(RUSAGE_SELF, &timer->self);
+	getrusage(RUSAGE_CHILDREN, &timer->children);
+	timer->maxrss = 0;
+}
+
+/**
+ * @brief Waits for a child with wait4() and keeps its peak memory usage.
+ * 
+ * The usage returned by wait4() covers the child and every descendant it
+ * reaped, so it is the exact peak RSS of a whole forked pipeline.
+ * RUSAGE_CHILDREN cannot give that, since its ru_maxrss never goes down.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param pid The child to wait for.
+ * @param status Where the raw wait status is stored.
+ */
+void	wait_usage(t_tools *tools, pid_t pid, int *status)
+{
+	struct rusage	usage;
+
+	if (wait4(pid, status, 0, &usage) > 0
+		&& usage.ru_maxrss > tools->timer.maxrss)
+		tools->timer.maxrss = usage.ru_maxrss;
+}
+
+/**
+ * @brief Computes the CPU and context switch deltas of a timed pipeline.
+ * 
+ * The shell's own usage is added to that of the children it reaped, so
+ * builtins running in-process and forked pipelines are both covered.
+ * 
+ * @param times Where the results are stored.
+ * @param timer The timer holding the starting snapshot.
+ */
+void	time_usage(t_times *times, t_timer *timer)
+{
+	struct rusage	self;
+	struct rusage	kids;
+
+	getrusage(RUSAGE_SELF, &self);
+	getrusage(RUSAGE_CHILDREN, &kids);
+	times->user = (self.ru_utime.tv_sec - timer->self.ru_utime.tv_sec
+			+ kids.ru_utime.tv_sec - timer->children.ru_utime.tv_sec) * 1000000
+		+ self.ru_utime.tv_usec - timer->self.ru_utime.tv_usec
+		+ kids.ru_utime.tv_usec - timer->children.ru_utime.tv_usec;
+	times->sys = (self.ru_stime.tv_sec - timer->self.ru_stime.tv_sec
+			+ kids.ru_stime.tv_sec - timer->children.ru_stime.tv_sec) * 1000000
+		+ self.ru_stime.tv_usec - timer->self.ru_stime.tv_usec
+		+ kids.ru_stime.tv_usec - timer->children.ru_stime.tv_usec;
+	times->nvcsw = self.ru_nvcsw - timer->self.ru_nvcsw
+		+ kids.ru_nvcsw - timer->children.ru_nvcsw;
+	times->nivcsw = self.ru_nivcsw - timer->self.ru_nivcsw
+		+ kids.ru_nivcsw - timer->children.ru_nivcsw;
+	times->maxrss = timer->maxrss;
+	if (!times->maxrss)
+		times->maxrss = self.ru_maxrss;
+}
+
+/**
+ * @brief Prints the timing report of a timed pipeline to stderr.
+ * 
+ * The format comes from the TIMEFORMAT variable when it is set (an empty
+ * value disables the report), from TIME_POSIX_FORMAT with "time -p" and from
+ * TIME_FORMAT otherwise.
+ * 
+ * @param tools Pointer to the tools structure.
+ */
+void	time_report(t_tools *tools)
+{
+	t_times			times;
+	struct timespec	now;
+	char			*format;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	times.real = (now.tv_sec - tools->timer.start.tv_sec) * 1000000
+		+ (now.tv_nsec - tools->timer.start.tv_nsec) / 1000;
+	time_usage(&times, &tools->timer);
+	times.cpu = 0;
+	if (times.real > 0)
+		times.cpu = (times.user + times.sys) * 100000000 / times.real;
+	format = NULL;
+	if (!tools->timer.posix)
+		format = get_var_from_env(tools->env, "TIMEFORMAT");
+	if (format)
+		time_print(format, &times);
+	else if (tools->timer.posix)
+		time_print(TIME_POSIX_FORMAT, &times);
+	else
+		time_print(TIME_FORMAT, &times);
+	free(format);
+}
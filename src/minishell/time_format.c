@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_format.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:34:32 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/18 23:34:32 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Appends the fractional digits of a fixed-point value.
+ * 
+ * @param buf The report buffer.
+ * @param micro The value, in millionths.
+ * @param precision The number of digits to print, from 1 to 3.
+ */
+void	time_fraction(char *buf, long micro, int precision)
+{
+	char	digits[5];
+	long	scale;
+	int		i;
+
+	digits[0] = '.';
+	scale = 100000;
+	i = 1;
+	while (i <= precision)
+	{
+		digits[i++] = '0' + micro / scale % 10;
+		scale /= 10;
+	}
+	digits[i] = '\0';
+	ft_strlcat(buf, digits, TIME_BUFFER);
+}
+
+/**
+ * @brief Appends a fixed-point value, such as a time in seconds.
+ * 
+ * The value is rounded to the requested precision. In long format it is
+ * split into minutes and seconds, like "1m2.345s".
+ * 
+ * @param buf The report buffer.
+ * @param micro The value, in millionths.
+ * @param precision The number of fractional digits, at most 3.
+ * @param longfmt Whether to use the MmS.FFFs format.
+ */
+void	time_fixed(char *buf, long micro, int precision, int longfmt)
+{
+	static const long	scale[4] = {1000000, 100000, 10000, 1000};
+	char				*nbr;
+
+	if (precision > 3)
+		precision = 3;
+	micro = (micro + scale[precision] / 2) / scale[precision]
+		* scale[precision];
+	if (longfmt)
+	{
+		nbr = ft_itoa(micro / 60000000);
+		ft_strlcat(buf, nbr, TIME_BUFFER);
+		ft_strlcat(buf, "m", TIME_BUFFER);
+		free(nbr);
+		micro %= 60000000;
+	}
+	nbr = ft_itoa(micro / 1000000);
+	ft_strlcat(buf, nbr, TIME_BUFFER);
+	free(nbr);
+	if (precision)
+		time_fraction(buf, micro, precision);
+	if (longfmt)
+		ft_strlcat(buf, "s", TIME_BUFFER);
+}
+
+/**
+ * @brief Appends one of the counters of a timing report.
+ * 
+ * @param buf The report buffer.
+ * @param c The directive: M (max RSS in KiB), w (voluntary context switches)
+ * or c (involuntary context switches).
+ * @param times The measured values.
+ * 
+ * @return 1 if the directive was handled, 0 otherwise.
+ */
+int	time_counter(char *buf, char c, t_times *times)
+{
+	char	*nbr;
+
+	if (c == 'M')
+		nbr = ft_itoa(times->maxrss);
+	else if (c == 'w')
+		nbr = ft_itoa(times->nvcsw);
+	else if (c == 'c')
+		nbr = ft_itoa(times->nivcsw);
+	else if (c == '%')
+		nbr = ft_strdup("%");
+	else
+		return (0);
+	ft_strlcat(buf, nbr, TIME_BUFFER);
+	free(nbr);
+	return (1);
+}
+
+/**
+ * @brief Expands a single TIMEFORMAT directive.
+ * 
+ * Supports %[p][l]R, %[p][l]U, %[p][l]S and %[p]P as in bash, where p is
+ * the precision (0 to 3, default 3) and l selects the MmS.FFFs format, plus
+ * %M, %w, %c and %%. Unknown directives are copied literally.
+ * 
+ * @param buf The report buffer.
+ * @param fmt The format, just after the '%'.
+ * @param times The measured values.
+ * 
+ * @return The number of format characters consumed.
+ */
+int	time_directive(char *buf, char *fmt, t_times *times)
+{
+	int	precision;
+	int	longfmt;
+	int	i;
+
+	i = 0;
+	precision = 3;
+	if (ft_isdigit(fmt[i]))
+		precision = fmt[i++] - '0';
+	longfmt = (fmt[i] == 'l');
+	i += longfmt;
+	if (fmt[i] == 'R')
+		time_fixed(buf, times->real, precision, longfmt);
+	else if (fmt[i] == 'U')
+		time_fixed(buf, times->user, precision, longfmt);
+	else if (fmt[i] == 'S')
+		time_fixed(buf, times->sys, precision, longfmt);
+	else if (fmt[i] == 'P')
+		time_fixed(buf, times->cpu, precision, 0);
+	else if (!time_counter(buf, fmt[i], times))
+	{
+		ft_strlcat(buf, "%", TIME_BUFFER);
+		return (0);
+	}
+	return (i + 1);
+}
+
+/**
+ * @brief Formats a timing report and writes it to stderr in one call.
+ * 
+ * Besides the directives, "\n" and "\t" are turned into a newline and a tab,
+ * since the shell has no other way of putting them in TIMEFORMAT.
+ * 
+ * @param fmt The report format.
+ * @param times The measured values.
+ */
+void	time_print(char *fmt, t_times *times)
+{
+	char	buf[TIME_BUFFER];
+	char	chr[2];
+	int		i;
+
+	buf[0] = '\0';
+	chr[1] = '\0';
+	i = 0;
+	while (fmt[i])
+	{
+		chr[0] = fmt[i++];
+		if (chr[0] == '%' && fmt[i])
+		{
+			i += time_directive(buf, fmt + i, times);
+			continue ;
+		}
+		if (chr[0] == '\\' && (fmt[i] == 'n' || fmt[i] == 't'))
+		{
+			chr[0] = '\t';
+			if (fmt[i++] == 'n')
+				chr[0] = '\n';
+		}
+		ft_strlcat(buf, chr, TIME_BUFFER);
+	}
+	ft_strlcat(buf, "\n", TIME_BUFFER);
+	write(STDERR_FILENO, buf, ft_strlen(buf));
+}
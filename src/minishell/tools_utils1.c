@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 14:37:31 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:45:57 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -103,22 +103,25 @@ void	free_tools(t_tools *tools)
 {
 	if (!tools)
 		return ;
+	read_sync();
 	if (tools && tools->env)
 		free_list(tools->env);
+	path_index_free();
+	if (shell_params()->argv)
+		free_list(shell_params()->argv);
+	shell_params()->argv = NULL;
+	hash_clear(shell_functions());
+	hash_clear(shell_aliases());
+	hash_clear(shell_arrays());
+	regex_cache_clear();
 	if (tools && tools->path)
 		free_list(tools->path);
-	if (tools && tools->pwd)
-		free(tools->pwd);
-	if (tools && tools->oldpwd)
-		free(tools->oldpwd);
-	if (tools && tools->home)
-		free(tools->home);
-	if (tools && tools->user)
-		free(tools->user);
-	if (tools && tools->name)
-		free(tools->name);
-	if (tools->pids)
-		free(tools->pids);
+	free(tools->pwd);
+	free(tools->oldpwd);
+	free(tools->home);
+	free(tools->user);
+	free(tools->name);
+	free(tools->pids);
 	if (tools->nint_mode)
 		free_list(tools->lines);
 }
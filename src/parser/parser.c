@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 14:37:08 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,7 +21,8 @@
  * 'builtin' flag is not set, it checks if the current
  * word is a built-in command. It then
  * duplicates the word and stores it in the parser
- * node's 'str' array.
+ * node's 'str' array. Assignments that come before any other word are
+ * counted, to be taken out of it once the command is complete.
  * 
  * @param node A pointer to the parser node.
  * @param current A pointer to the current lexer node.
@@ -43,6 +44,8 @@ int	parse_words(t_parser *node, t_lexer *current)
 		free_parser(&node);
 		return (0);
 	}
+	if (i == node->nb_assigns && current->assign)
+		node->nb_assigns++;
 	return (1);
 }
 
@@ -70,9 +73,7 @@ t_lexer	*parse_tokens(t_parser *node, t_lexer *current, int *start)
 		if (ft_isdigit(current->token) || current->token == '&')
 			current = add_redirection(current, node, start);
 		node->nb_redirections++;
-		current = add_redirection(current, node, NULL);
-		if (current && (current->token == '<' || current->token == '>'))
-			current = add_redirection(current, node, start);
+		current = add_redirection_operator(current, node, start);
 		if (current && (current->token || !current->words))
 		{
 			syntax_err(current->token);
@@ -128,7 +129,7 @@ int	get_command(t_parser *node, t_lexer *lexer, int *start, int end)
 		}
 		(*start)++;
 	}
-	return (1);
+	return (parser_assigns(node));
 }
 
 /**
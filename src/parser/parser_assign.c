@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_assign.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:49:39 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Takes the leading assignments out of a command.
+ * 
+ * In "VAR=value cmd" the assignments only go to the environment of cmd,
+ * so they are kept aside in node->assigns and the command is looked up
+ * again from its first remaining word. A command made of assignments
+ * alone is left as it is.
+ * 
+ * @param node The parser node, complete.
+ * 
+ * @return 1 on success, 0 on failure.
+ */
+int	parser_assigns(t_parser *node)
+{
+	int	count;
+
+	if (!node->nb_assigns || !node->str[node->nb_assigns])
+	{
+		node->nb_assigns = 0;
+		return (1);
+	}
+	node->assigns = ft_calloc(node->nb_assigns + 1, sizeof(char *));
+	if (!node->assigns)
+		return (0);
+	ft_memcpy(node->assigns, node->str, node->nb_assigns * sizeof(char *));
+	count = count_lines(node->str + node->nb_assigns);
+	ft_memmove(node->str, node->str + node->nb_assigns,
+		(count + 1) * sizeof(char *));
+	if (!node->builtin)
+		node->builtin = is_builtin(node->str[0]);
+	return (1);
+}
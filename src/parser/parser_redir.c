@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 14:37:00 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 01:16:14 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -37,6 +37,7 @@ t_lexer	*add_redirection(t_lexer *current, t_parser *node, int *start)
 		return (NULL);
 	redirections_node->index = current->index;
 	redirections_node->token = current->token;
+	redirections_node->quoted = current->quoted;
 	if (current->words)
 	{
 		redirections_node->words = ft_strdup(current->words);
@@ -53,3 +54,32 @@ t_lexer	*add_redirection(t_lexer *current, t_parser *node, int *start)
 		(*start)++;
 	return (current);
 }
+
+/**
+ * @brief Adds the operator of a redirection to the parser node.
+ * 
+ * The operator is '<' or '>', optionally doubled, optionally followed by
+ * '&' for the "N>&M" and "N>&-" forms. A third '<' makes a here-string.
+ * 
+ * @param current The first token of the operator.
+ * @param node The parser node the redirection belongs to.
+ * @param start Pointer to the index of the current token, advanced for
+ * each extra token consumed.
+ * 
+ * @return The token following the operator.
+ */
+t_lexer	*add_redirection_operator(t_lexer *current, t_parser *node, int *start)
+{
+	int	less_less;
+
+	less_less = (current->token == '<' && current->next
+			&& current->next->token == '<');
+	current = add_redirection(current, node, NULL);
+	if (current && (current->token == '<' || current->token == '>'))
+		current = add_redirection(current, node, start);
+	if (current && less_less && current->token == '<')
+		current = add_redirection(current, node, start);
+	if (current && current->token == '&')
+		current = add_redirection(current, node, start);
+	return (current);
+}
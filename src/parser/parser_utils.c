@@ -6,7 +6,7 @@
 /*   By: crebelo- <crebelo-@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/05/14 15:26:27 by ftomaz-c          #+#    #+#             */
-/*   Updated: 2024/05/28 14:37:03 by crebelo-         ###   ########.fr       */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,8 +22,11 @@ void	count_heredocs(t_parser *parser)
 	{
 		if (current->token == '<' && current->next->token == '<')
 		{
-			parser->nb_heredocs++;
 			current = current->next;
+			if (current->next->token == '<')
+				current = current->next;
+			else
+				parser->nb_heredocs++;
 		}
 		current = current->next;
 	}
@@ -81,8 +84,11 @@ void	free_parser(t_parser **parser)
 		next = current->next;
 		if (current->str != NULL)
 			free_list(current->str);
+		if (current->assigns != NULL)
+			free_list(current->assigns);
 		if (current->redirections)
 			free_lexer(&current->redirections);
+		close_heredocs(current);
 		free(current);
 		current = next;
 	}
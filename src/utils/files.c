@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   files.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:28:58 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:51:52 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/utils.h"
+
+/**
+ * @brief Builds a unique scratch file name for the current process.
+ * 
+ * The name is made of the shell's PID and a per-process counter, with a
+ * dash between them so that no two pairs give the same name.
+ * 
+ * @return A dynamically allocated path inside /tmp, or NULL on error.
+ */
+static char	*anon_file_name(void)
+{
+	static int	counter;
+	char		*pid;
+	char		*nbr;
+	char		*tmp;
+	char		*name;
+
+	pid = ft_itoa(getpid());
+	nbr = ft_itoa(counter++);
+	tmp = append_len(ft_strjoin("/tmp/.minishell-", pid), "-", 1);
+	name = ft_strjoin(tmp, nbr);
+	free(pid);
+	free(nbr);
+	free(tmp);
+	return (name);
+}
+
+/**
+ * @brief Opens an anonymous, read/write scratch file.
+ * 
+ * A memfd is used when the kernel supports it. Otherwise a file is created
+ * in /tmp with O_EXCL and unlinked right away, trying the next name when
+ * one is already taken. Either way it lives only as long as its
+ * descriptor and, unlike a pipe, has no fixed capacity.
+ * 
+ * @return The file descriptor, or -1 on error.
+ */
+int	anon_file(void)
+{
+	char	*name;
+	int		fd;
+
+	fd = memfd_create("minishell", MFD_CLOEXEC);
+	if (fd >= 0)
+		return (fd);
+	errno = EEXIST;
+	while (fd < 0 && errno == EEXIST)
+	{
+		name = anon_file_name();
+		if (!name)
+			return (-1);
+		fd = open(name, O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+		if (fd >= 0)
+			unlink(name);
+		free(name);
+	}
+	return (fd);
+}
+
+/**
+ * @brief Copies everything from one descriptor to another.
+ * 
+ * Reads in FILE_CHUNK sized blocks so that large outputs are moved with as
+ * few system calls as possible.
+ * 
+ * @param from The descriptor to read from, starting at its current offset.
+ * @param to The descriptor to write to.
+ * 
+ * @return 0 on success, -1 on a read or write error.
+ */
+int	copy_fd(int from, int to)
+{
+	char	buffer[FILE_CHUNK];
+	ssize_t	bytes;
+
+	bytes = read(from, buffer, FILE_CHUNK);
+	while (bytes > 0)
+	{
+		if (write(to, buffer, bytes) != bytes)
+			return (-1);
+		bytes = read(from, buffer, FILE_CHUNK);
+	}
+	if (bytes < 0)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Reads a descriptor until end-of-file, growing the buffer as needed.
+ * 
+ * The buffer doubles every time it fills up, so slurping a large file costs
+ * O(log n) reallocations and FILE_CHUNK or larger reads.
+ * 
+ * @param fd The descriptor to read.
+ * @param data Pointer to the buffer. It may be replaced when it grows.
+ * @param size Pointer to the buffer capacity, not counting the terminator.
+ * 
+ * @return The number of bytes read, or -1 on error.
+ */
+static ssize_t	fill_buffer(int fd, char **data, size_t *size)
+{
+	size_t	used;
+	ssize_t	bytes;
+
+	used = 0;
+	bytes = 1;
+	while (*data && bytes > 0)
+	{
+		if (used == *size)
+		{
+			*data = ft_realloc(*data, *size * 2 + 1, *size + 1);
+			*size *= 2;
+		}
+		if (*data)
+			bytes = read(fd, *data + used, *size - used);
+		if (*data && bytes > 0)
+			used += bytes;
+	}
+	if (!*data || bytes < 0)
+		return (-1);
+	return (used);
+}
+
+/**
+ * @brief Reads a descriptor until end-of-file into a single buffer.
+ * 
+ * @param fd The descriptor to read.
+ * @param len Where the number of bytes read is stored. Can be NULL.
+ * 
+ * @return A null-terminated buffer holding the data, or NULL on error.
+ */
+char	*read_fd(int fd, size_t *len)
+{
+	char	*data;
+	size_t	size;
+	ssize_t	used;
+
+	size = FILE_CHUNK;
+	data = malloc(size + 1);
+	used = fill_buffer(fd, &data, &size);
+	if (used < 0)
+	{
+		free(data);
+		return (NULL);
+	}
+	data[used] = '\0';
+	if (len)
+		*len = used;
+	return (data);
+}
@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   glob_match.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:39:30 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:44:00 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Tells whether a character is in the set of an operation.
+ * 
+ * @param op The operation.
+ * @param c The character.
+ * 
+ * @return 1 if it is, 0 otherwise or if the operation is not a set.
+ */
+static int	gop_has(t_gop *op, unsigned char c)
+{
+	return (op->type == GOP_SET && ((op->set[c >> 3] >> (c & 7)) & 1));
+}
+
+/**
+ * @brief Compiles a bracket expression into a set of characters.
+ * 
+ * Same syntax as in match_pattern(): ranges, negation with '!' or '^', a
+ * leading ']' taken literally and backslash escapes.
+ * 
+ * @param p The pattern, on the opening '['.
+ * @param op The operation to fill.
+ * 
+ * @return The length of the expression, or 0 if it is not closed.
+ */
+static int	gop_bracket(char *p, t_gop *op)
+{
+	int	neg;
+	int	c;
+	int	i;
+
+	neg = (p[1] == '!' || p[1] == '^');
+	i = 1 + neg;
+	c = -1;
+	while (p[i] && (p[i] != ']' || c < 0))
+	{
+		i += (p[i] == '\\' && p[i + 1]);
+		c = (unsigned char)p[i];
+		if (p[i + 1] == '-' && p[i + 2] && p[i + 2] != ']')
+			i += 2;
+		while (c <= (unsigned char)p[i])
+		{
+			op->set[c >> 3] |= 1 << (c & 7);
+			c++;
+		}
+		i++;
+	}
+	c = 0;
+	while (neg && c < 32)
+		op->set[c++] ^= 0xff;
+	return ((i + 1) * (p[i] == ']'));
+}
+
+/**
+ * @brief Compiles the next element of a pattern.
+ * 
+ * Everything but '*' becomes a set of characters: '?' holds all of them,
+ * a literal holds one.
+ * 
+ * @param p The pattern.
+ * @param op The operation to fill.
+ * 
+ * @return The length of the element.
+ */
+static int	gop_one(char *p, t_gop *op)
+{
+	int	len;
+
+	ft_bzero(op, sizeof(t_gop));
+	op->type = GOP_SET;
+	if (*p == '*')
+		op->type = GOP_STAR;
+	if (*p == '*')
+		return (1);
+	if (*p == '?')
+		ft_memset(op->set, 0xff, sizeof(op->set));
+	if (*p == '?')
+		return (1);
+	if (*p == '[')
+	{
+		len = gop_bracket(p, op);
+		if (len)
+			return (len);
+		ft_bzero(op->set, sizeof(op->set));
+	}
+	len = 1 + (*p == '\\' && p[1]);
+	op->set[(unsigned char)p[len - 1] >> 3] |= 1 << (p[len - 1] & 7);
+	return (len);
+}
+
+/**
+ * @brief Compiles a pattern into a list of operations.
+ * 
+ * The pattern is parsed once; matching a name against the result is a
+ * bit test per character, however many names are matched.
+ * 
+ * @param p The pattern, in the syntax of match_pattern().
+ * 
+ * @return The operations, ended by GOP_END, or NULL on allocation error.
+ */
+t_gop	*glob_compile(char *p)
+{
+	t_gop	*ops;
+	int		k;
+
+	ops = ft_calloc(ft_strlen(p) + 1, sizeof(t_gop));
+	if (!ops)
+		return (NULL);
+	k = 0;
+	while (*p)
+	{
+		p += gop_one(p, &ops[k]);
+		if (!(k && ops[k].type == GOP_STAR && ops[k - 1].type == GOP_STAR))
+			k++;
+	}
+	ops[k].type = GOP_END;
+	return (ops);
+}
+
+/**
+ * @brief Matches a string against compiled operations.
+ * 
+ * Like match_pattern(), only the last '*' is ever retried.
+ * 
+ * @param op The operations.
+ * @param s The string.
+ * 
+ * @return 1 if the whole string matches, 0 otherwise.
+ */
+int	glob_match(t_gop *op, char *s)
+{
+	t_gop	*star_op;
+	char	*star_s;
+
+	star_op = NULL;
+	star_s = s;
+	while (*s || op->type == GOP_STAR)
+	{
+		if (op->type == GOP_STAR)
+			star_s = s;
+		if (op->type == GOP_STAR)
+			star_op = ++op;
+		else if (gop_has(op, *s))
+		{
+			op++;
+			s++;
+		}
+		else if (!star_op)
+			return (0);
+		else
+		{
+			op = star_op;
+			s = ++star_s;
+		}
+	}
+	return (op->type == GOP_END);
+}
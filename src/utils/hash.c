@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:30:34 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:34:42 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/utils.h"
+
+/**
+ * @brief Hashes a key with FNV-1a.
+ * 
+ * @param key The key.
+ * 
+ * @return The hash of the key.
+ */
+unsigned int	hash_key(char *key)
+{
+	unsigned int	h;
+
+	h = 2166136261u;
+	while (*key)
+		h = (h ^ (unsigned char)*key++) * 16777619u;
+	return (h);
+}
+
+/**
+ * @brief Doubles the number of buckets of a table, or gives an empty table
+ * its first ones.
+ * 
+ * The entries are moved over, not copied. On allocation error the table is
+ * left as it was, only more crowded.
+ * 
+ * @param hash The table.
+ */
+static void	hash_grow(t_hash *hash)
+{
+	t_entry	**buckets;
+	t_entry	*entry;
+	t_entry	*next;
+	int		size;
+	int		i;
+
+	size = hash->size * 2 + (hash->size == 0) * HASH_SIZE;
+	buckets = ft_calloc(size, sizeof(t_entry *));
+	if (!buckets)
+		return ;
+	i = 0;
+	while (i < hash->size)
+	{
+		entry = hash->buckets[i++];
+		while (entry)
+		{
+			next = entry->next;
+			entry->next = buckets[hash_key(entry->key) & (size - 1)];
+			buckets[hash_key(entry->key) & (size - 1)] = entry;
+			entry = next;
+		}
+	}
+	free(hash->buckets);
+	hash->buckets = buckets;
+	hash->size = size;
+}
+
+/**
+ * @brief Finds the entry of a key.
+ * 
+ * @param hash The table.
+ * @param key The key.
+ * 
+ * @return The entry, or NULL if the key is not in the table.
+ */
+t_entry	*hash_find(t_hash *hash, char *key)
+{
+	t_entry	*entry;
+
+	if (!hash->buckets)
+		return (NULL);
+	entry = hash->buckets[hash_key(key) & (hash->size - 1)];
+	while (entry && ft_strcmp(entry->key, key) != 0)
+		entry = entry->next;
+	return (entry);
+}
+
+/**
+ * @brief Returns the value of a key.
+ * 
+ * @param hash The table.
+ * @param key The key.
+ * 
+ * @return The value, or NULL if the key is not in the table.
+ */
+void	*hash_get(t_hash *hash, char *key)
+{
+	t_entry	*entry;
+
+	entry = hash_find(hash, key);
+	if (!entry)
+		return (NULL);
+	return (entry->value);
+}
+
+/**
+ * @brief Sets the value of a key.
+ * 
+ * The key is copied and the table takes the value over. A value the key
+ * had before is handed to the del function of the table.
+ * 
+ * @param hash The table.
+ * @param key The key.
+ * @param value The value.
+ * 
+ * @return 1 on success, 0 if memory ran out.
+ */
+int	hash_set(t_hash *hash, char *key, void *value)
+{
+	t_entry	*entry;
+
+	entry = hash_find(hash, key);
+	if (entry)
+	{
+		if (hash->del)
+			hash->del(entry->value);
+		entry->value = value;
+		return (1);
+	}
+	if (hash->count >= hash->size)
+		hash_grow(hash);
+	entry = ft_calloc(1, sizeof(t_entry));
+	if (entry && hash->buckets)
+		entry->key = ft_strdup(key);
+	if (!entry || !entry->key)
+	{
+		free(entry);
+		return (0);
+	}
+	entry->value = value;
+	entry->next = hash->buckets[hash_key(key) & (hash->size - 1)];
+	hash->buckets[hash_key(key) & (hash->size - 1)] = entry;
+	hash->count++;
+	return (1);
+}
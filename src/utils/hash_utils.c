@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_utils.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:30:53 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:38:11 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/utils.h"
+
+/**
+ * @brief Frees an entry and hands its value to the del function.
+ * 
+ * @param hash The table the entry belonged to.
+ * @param entry The entry.
+ */
+static void	entry_free(t_hash *hash, t_entry *entry)
+{
+	if (hash->del)
+		hash->del(entry->value);
+	free(entry->key);
+	free(entry);
+}
+
+/**
+ * @brief Removes a key from a table.
+ * 
+ * @param hash The table.
+ * @param key The key.
+ * 
+ * @return 1 if the key was there, 0 otherwise.
+ */
+int	hash_del(t_hash *hash, char *key)
+{
+	t_entry	**link;
+	t_entry	*entry;
+
+	if (!hash->buckets)
+		return (0);
+	link = &hash->buckets[hash_key(key) & (hash->size - 1)];
+	while (*link && ft_strcmp((*link)->key, key) != 0)
+		link = &(*link)->next;
+	if (!*link)
+		return (0);
+	entry = *link;
+	*link = entry->next;
+	entry_free(hash, entry);
+	hash->count--;
+	return (1);
+}
+
+/**
+ * @brief Removes every key from a table and frees its buckets.
+ * 
+ * @param hash The table.
+ */
+void	hash_clear(t_hash *hash)
+{
+	t_entry	*entry;
+	t_entry	*next;
+	int		i;
+
+	i = 0;
+	while (hash->buckets && i < hash->size)
+	{
+		entry = hash->buckets[i++];
+		while (entry)
+		{
+			next = entry->next;
+			entry_free(hash, entry);
+			entry = next;
+		}
+	}
+	free(hash->buckets);
+	hash->buckets = NULL;
+	hash->size = 0;
+	hash->count = 0;
+}
+
+/**
+ * @brief Lists the keys of a table in byte order.
+ * 
+ * The order does not depend on the locale, so listings are stable.
+ * 
+ * @param hash The table.
+ * 
+ * @return A NULL-terminated array of the keys, which still belong to the
+ * table, or NULL if memory ran out. Only the array is to be freed.
+ */
+char	**hash_keys(t_hash *hash)
+{
+	char	**keys;
+	t_entry	*entry;
+	int		n;
+	int		i;
+
+	keys = ft_calloc(hash->count + 1, sizeof(char *));
+	if (!keys)
+		return (NULL);
+	n = 0;
+	i = 0;
+	while (hash->buckets && i < hash->size)
+	{
+		entry = hash->buckets[i++];
+		while (entry)
+		{
+			keys[n++] = entry->key;
+			entry = entry->next;
+		}
+	}
+	qsort(keys, n, sizeof(char *), compare_names);
+	return (keys);
+}
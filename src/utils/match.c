@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   match.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:22:04 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:28:44 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Matches a character against a bracket expression.
+ * 
+ * Supports ranges, negation with '!' or '^', a leading ']' taken
+ * literally and backslash escapes.
+ * 
+ * @param p The pattern, on the opening '['.
+ * @param c The character.
+ * @param hit Set to 1 if the character matches, 0 otherwise.
+ * 
+ * @return The length of the expression, or 0 if it is not closed, in which
+ * case the '[' is an ordinary character.
+ */
+static int	match_bracket(char *p, unsigned char c, int *hit)
+{
+	int	neg;
+	int	i;
+
+	i = 1;
+	neg = (p[i] == '!' || p[i] == '^');
+	i += neg;
+	*hit = 0;
+	if (p[i] == ']')
+		*hit |= (c == (unsigned char)p[i++]);
+	while (p[i] && p[i] != ']')
+	{
+		i += (p[i] == '\\' && p[i + 1]);
+		if (p[i + 1] == '-' && p[i + 2] && p[i + 2] != ']')
+		{
+			*hit |= (c >= (unsigned char)p[i]
+					&& c <= (unsigned char)p[i + 2]);
+			i += 3;
+		}
+		else
+			*hit |= (c == (unsigned char)p[i++]);
+	}
+	if (!p[i])
+		return (0);
+	*hit ^= neg;
+	return (i + 1);
+}
+
+/**
+ * @brief Matches a character against the next element of a pattern.
+ * 
+ * @param p The pattern, on anything but a '*'.
+ * @param c The character.
+ * 
+ * @return The length of the element if it matches, 0 otherwise.
+ */
+static int	match_one(char *p, char c)
+{
+	int	len;
+	int	hit;
+
+	if (!*p)
+		return (0);
+	if (*p == '?')
+		return (1);
+	if (*p == '[')
+	{
+		len = match_bracket(p, c, &hit);
+		if (len)
+			return (len * hit);
+	}
+	if (*p == '\\' && p[1])
+		return (2 * (p[1] == c));
+	return (*p == c);
+}
+
+/**
+ * @brief Tells whether what is left of a pattern matches an empty string.
+ * 
+ * @param p The rest of the pattern.
+ * 
+ * @return 1 if it is only made of '*', 0 otherwise.
+ */
+static int	match_end(char *p)
+{
+	while (*p == '*')
+		p++;
+	return (!*p);
+}
+
+/**
+ * @brief Matches a string against a shell pattern.
+ * 
+ * '*' matches any string, '?' any character, "[...]" a set of characters
+ * and a backslash makes the next character literal. On a mismatch only
+ * the last '*' is retried one character further, so no backtracking tree
+ * is ever explored.
+ * 
+ * @param p The pattern.
+ * @param s The string.
+ * 
+ * @return 1 if the whole string matches, 0 otherwise.
+ */
+int	match_pattern(char *p, char *s)
+{
+	char	*star[2];
+	int		len;
+
+	star[0] = NULL;
+	star[1] = s;
+	while (*s)
+	{
+		if (*p == '*')
+		{
+			star[0] = ++p;
+			star[1] = s;
+			continue ;
+		}
+		len = match_one(p, *s);
+		if (!len && !star[0])
+			return (0);
+		p += len;
+		s += (len > 0);
+		if (!len)
+		{
+			p = star[0];
+			s = ++star[1];
+		}
+	}
+	return (match_end(p));
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:50:16 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:21:56 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/utils.h"
+
+/**
+ * @brief Returns the index of the executables found on PATH.
+ * 
+ * @return Pointer to the index. It lives for the whole run of the shell.
+ */
+t_path_index	*path_index(void)
+{
+	static t_path_index	index;
+
+	return (&index);
+}
+
+/**
+ * @brief Appends a name to a directory of the index.
+ * 
+ * @param dir The directory.
+ * @param name The name to append. It is copied.
+ * @param size Pointer to the current capacity, updated when it grows.
+ * 
+ * @return 1 on success, 0 if memory ran out.
+ */
+static int	dir_add(t_path_dir *dir, char *name, int *size)
+{
+	char	**entries;
+
+	if (dir->count == *size)
+	{
+		entries = ft_realloc(dir->entries, sizeof(char *) * (*size * 2 + 64),
+				sizeof(char *) * *size);
+		if (!entries)
+			return (0);
+		dir->entries = entries;
+		*size = *size * 2 + 64;
+	}
+	dir->entries[dir->count] = ft_strdup(name);
+	if (!dir->entries[dir->count])
+		return (0);
+	dir->count++;
+	return (1);
+}
+
+/**
+ * @brief Reads the names in a directory with a single pass of readdir().
+ * 
+ * Subdirectories and hidden files are skipped and the names are sorted so
+ * they can be binary searched. Nothing is stat()ed: whether a name is
+ * really executable is left to execve().
+ * 
+ * @param dir The directory to read.
+ */
+static void	dir_read(t_path_dir *dir)
+{
+	DIR				*stream;
+	struct dirent	*entry;
+	int				size;
+
+	stream = opendir(dir->name);
+	dir->complete = (stream != NULL);
+	size = 0;
+	while (dir->complete)
+	{
+		entry = readdir(stream);
+		if (!entry)
+			break ;
+		if (entry->d_name[0] != '.' && entry->d_type != DT_DIR)
+			dir->complete = dir_add(dir, entry->d_name, &size);
+	}
+	if (stream)
+		closedir(stream);
+	if (dir->count > 1)
+		qsort(dir->entries, dir->count, sizeof(char *), compare_names);
+}
+
+/**
+ * @brief Reads a directory again if it changed since the last scan.
+ * 
+ * A directory's mtime changes whenever an entry is added, removed or
+ * renamed, so comparing it is enough to know the list is still valid.
+ * A directory that does not exist is known to be empty; one that cannot
+ * be read is marked incomplete so lookups fall back to execve().
+ * 
+ * @param dir The directory to check.
+ * 
+ * @return 1 if the directory was read again, 0 otherwise.
+ */
+static int	dir_refresh(t_path_dir *dir)
+{
+	struct stat	st;
+	int			found;
+
+	found = (stat(dir->name, &st) == 0);
+	if (!found)
+		ft_memset(&st, 0, sizeof(st));
+	if (dir->scanned && st.st_mtim.tv_sec == dir->mtime.tv_sec
+		&& st.st_mtim.tv_nsec == dir->mtime.tv_nsec)
+		return (0);
+	while (dir->count)
+		free(dir->entries[--dir->count]);
+	free(dir->entries);
+	dir->entries = NULL;
+	dir->mtime = st.st_mtim;
+	dir->scanned = 1;
+	if (found)
+		dir_read(dir);
+	else
+		dir->complete = (errno == ENOENT || errno == ENOTDIR);
+	return (1);
+}
+
+/**
+ * @brief Brings the index up to date with the directories in path.
+ * 
+ * The first call reads every directory; later calls only stat() them and
+ * read again the ones whose mtime changed.
+ * 
+ * @param path The list of PATH directories (tools->path).
+ */
+void	path_index_update(char **path)
+{
+	t_path_index	*index;
+	int				changed;
+	int				i;
+
+	index = path_index();
+	if (!path)
+		return ;
+	if ((index->path != path || !index->dirs)
+		&& !path_index_reset(index, path))
+		return ;
+	changed = 0;
+	i = 0;
+	while (i < index->ndirs)
+		changed |= dir_refresh(&index->dirs[i++]);
+	if (changed)
+		path_index_merge(index);
+}
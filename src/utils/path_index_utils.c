@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_index_utils.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:50:17 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/18 23:51:41 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/utils.h"
+
+/**
+ * @brief Removes the duplicates from a sorted list of names, in place.
+ * 
+ * @param names The sorted list.
+ * @param count Number of names.
+ * 
+ * @return The number of distinct names left.
+ */
+static int	unique_names(char **names, int count)
+{
+	int	kept;
+	int	i;
+
+	kept = 0;
+	i = 0;
+	while (i < count)
+	{
+		if (!kept || ft_strcmp(names[kept - 1], names[i]))
+			names[kept++] = names[i];
+		i++;
+	}
+	return (kept);
+}
+
+/**
+ * @brief Drops the index and prepares an empty one for a new path list.
+ * 
+ * @param index The index.
+ * @param path The list of PATH directories. It must outlive the index.
+ * 
+ * @return 1 on success, 0 if memory ran out.
+ */
+int	path_index_reset(t_path_index *index, char **path)
+{
+	int	i;
+
+	path_index_free();
+	index->path = path;
+	index->ndirs = count_lines(path);
+	index->dirs = ft_calloc(index->ndirs + 1, sizeof(t_path_dir));
+	if (!index->dirs)
+		return (0);
+	i = 0;
+	while (i < index->ndirs)
+	{
+		index->dirs[i].name = path[i];
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Builds the sorted list of distinct command names on PATH.
+ * 
+ * The list points into the per-directory entries, it does not own them.
+ * 
+ * @param index The index.
+ */
+void	path_index_merge(t_path_index *index)
+{
+	int	total;
+	int	i;
+
+	free(index->names);
+	index->count = 0;
+	total = 0;
+	i = 0;
+	while (i < index->ndirs)
+		total += index->dirs[i++].count;
+	index->names = malloc(sizeof(char *) * (total + 1));
+	if (!index->names)
+		return ;
+	i = -1;
+	while (++i < index->ndirs)
+	{
+		ft_memcpy(index->names + index->count, index->dirs[i].entries,
+			sizeof(char *) * index->dirs[i].count);
+		index->count += index->dirs[i].count;
+	}
+	qsort(index->names, total, sizeof(char *), compare_names);
+	index->count = unique_names(index->names, total);
+}
+
+/**
+ * @brief Frees everything held by the index.
+ */
+void	path_index_free(void)
+{
+	t_path_index	*index;
+	int				i;
+
+	index = path_index();
+	i = 0;
+	while (index->dirs && i < index->ndirs)
+	{
+		while (index->dirs[i].count)
+			free(index->dirs[i].entries[--index->dirs[i].count]);
+		free(index->dirs[i++].entries);
+	}
+	free(index->dirs);
+	free(index->names);
+	ft_memset(index, 0, sizeof(t_path_index));
+}
+
+/**
+ * @brief Looks a command name up in the index.
+ * 
+ * Directories are searched in PATH order with a binary search each.
+ * 
+ * @param path The list of PATH directories (tools->path).
+ * @param name The command name, without any '/'.
+ * @param full Set to the full path of the command when it is found.
+ * 
+ * @return 1 if found, 0 if it is on no PATH directory, -1 if the index
+ * cannot tell (an unreadable directory, or no memory).
+ */
+int	path_index_find(char **path, char *name, char **full)
+{
+	t_path_index	*index;
+	t_path_dir		*dir;
+	int				i;
+
+	path_index_update(path);
+	index = path_index();
+	if (!index->dirs)
+		return (-1);
+	i = 0;
+	while (i < index->ndirs)
+	{
+		dir = &index->dirs[i++];
+		if (!dir->complete)
+			return (-1);
+		if (!dir->count || !bsearch(&name, dir->entries, dir->count,
+				sizeof(char *), compare_names))
+			continue ;
+		*full = append_len(ft_strjoin(dir->name, "/"), name, ft_strlen(name));
+		if (!*full)
+			return (-1);
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   utils4.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:38:54 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 00:28:44 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Duplicates a slice of a null-terminated list of strings.
+ * 
+ * @param list The list to copy from.
+ * @param start Index of the first string to copy.
+ * @param end Index one past the last string to copy.
+ * 
+ * @return A new null-terminated list, or NULL on allocation error.
+ */
+char	**list_dup(char **list, int start, int end)
+{
+	char	**copy;
+	int		i;
+
+	copy = ft_calloc(end - start + 1, sizeof(char *));
+	if (!copy)
+		return (NULL);
+	i = 0;
+	while (start < end)
+	{
+		copy[i] = ft_strdup(list[start++]);
+		if (!copy[i++])
+		{
+			free_list(copy);
+			return (NULL);
+		}
+	}
+	return (copy);
+}
+
+/**
+ * @brief Appends a string to a list, freeing the old list.
+ * 
+ * @param list The null-terminated list, or NULL for an empty one. It is
+ * freed.
+ * @param str The string to append. The list takes it over.
+ * 
+ * @return The new list, or NULL on allocation error, in which case both
+ * the list and the string are freed.
+ */
+char	**list_add(char **list, char *str)
+{
+	char	**copy;
+	int		n;
+
+	n = 0;
+	if (list)
+		n = count_lines(list);
+	copy = NULL;
+	if (str)
+		copy = ft_calloc(n + 2, sizeof(char *));
+	if (!copy)
+	{
+		if (list)
+			free_list(list);
+		free(str);
+		return (NULL);
+	}
+	ft_memcpy(copy, list, n * sizeof(char *));
+	copy[n] = str;
+	free(list);
+	return (copy);
+}
+
+/**
+ * @brief Appends the first len bytes of part to str, freeing str.
+ * 
+ * @param str The string to extend. It is freed.
+ * @param part The string to append from.
+ * @param len The number of bytes of part to append.
+ * 
+ * @return The newly allocated concatenation.
+ */
+char	*append_len(char *str, char *part, size_t len)
+{
+	char	*tmp;
+	char	*joined;
+
+	tmp = ft_substr(part, 0, len);
+	joined = ft_strjoin(str, tmp);
+	free(str);
+	free(tmp);
+	return (joined);
+}
+
+/**
+ * @brief qsort() and bsearch() comparison of two names.
+ * 
+ * @param a Pointer to the first name.
+ * @param b Pointer to the second name.
+ * 
+ * @return The result of ft_strcmp() on the two names.
+ */
+int	compare_names(const void *a, const void *b)
+{
+	return (ft_strcmp(*(char **)a, *(char **)b));
+}
+
+/**
+ * @brief Returns the positional parameters of the shell.
+ * 
+ * argv[0] is $0 and the following strings are $1, $2 and so on. Builtins
+ * like source replace the list for as long as they run.
+ * 
+ * @return Pointer to the parameters.
+ */
+t_params	*shell_params(void)
+{
+	static t_params	params;
+
+	return (&params);
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   utils5.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ftomaz-c <ftomaz-c@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:01:19 by ftomaz-c          #+#    #+#             */
+/*   Updated: 2026/10/19 02:00:15 by ftomaz-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Checks that a string is a valid shell variable name.
+ * 
+ * @param str The name to check.
+ * 
+ * @return 1 if the name starts with a letter or '_' and only has
+ * letters, digits and '_', 0 otherwise.
+ */
+int	is_valid_name(char *str)
+{
+	int	i;
+
+	if (!str || (!ft_isalpha(str[0]) && str[0] != '_'))
+		return (0);
+	i = 1;
+	while (str[i] && (ft_isalnum(str[i]) || str[i] == '_'))
+		i++;
+	return (str[i] == '\0');
+}
+
+/**
+ * @brief Tells whether a word is a variable assignment, "NAME=value".
+ * 
+ * The name and the '=' must not be quoted, which the word still shows.
+ * 
+ * @param word The word, before quote removal.
+ * 
+ * @return 1 if it is an assignment, 0 otherwise.
+ */
+int	is_assignment(char *word)
+{
+	int	i;
+
+	if (!word || (!ft_isalpha(word[0]) && word[0] != '_'))
+		return (0);
+	i = 1;
+	while (ft_isalnum(word[i]) || word[i] == '_')
+		i++;
+	return (word[i] == '=');
+}
+
+/**
+ * @brief Appends an entry to the environment array.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param entry The "NAME=value" entry, owned by the environment afterwards.
+ */
+static void	env_append(t_tools *tools, char *entry)
+{
+	char	**new_env;
+	int		count;
+
+	count = 0;
+	if (tools->env)
+		count = count_lines(tools->env);
+	new_env = ft_calloc(sizeof(char *), count + 2);
+	if (!new_env)
+	{
+		free(entry);
+		return ;
+	}
+	if (count)
+		ft_memcpy(new_env, tools->env, sizeof(char *) * count);
+	new_env[count] = entry;
+	free(tools->env);
+	tools->env = new_env;
+}
+
+/**
+ * @brief Sets a shell variable, replacing its value if it already exists.
+ * 
+ * Unlike export this takes the name and the value separately, so values
+ * coming from input (read, loops, arithmetic...) are stored verbatim.
+ * 
+ * @param tools Pointer to the tools structure.
+ * @param name The variable name.
+ * @param value The new value.
+ */
+void	set_var(t_tools *tools, char *name, char *value)
+{
+	char	*entry;
+	char	*tmp;
+	int		i;
+
+	tmp = ft_strjoin(name, "=");
+	if (!tmp)
+		return ;
+	entry = ft_strjoin(tmp, value);
+	free(tmp);
+	if (!entry)
+		return ;
+	i = 0;
+	while (tools->env && tools->env[i])
+	{
+		if (compare_var_to_env(tools->env[i], name))
+		{
+			free(tools->env[i]);
+			tools->env[i] = entry;
+			return ;
+		}
+		i++;
+	}
+	env_append(tools, entry);
+}
+
+/**
+ * @brief Returns the options of filename expansion.
+ * 
+ * Words that are not split into arguments, like case subjects and
+ * patterns, are lexed with expansion disabled. The environment is the one
+ * of the line being lexed, which holds GLOB_THREADS.
+ * 
+ * @return Pointer to the options.
+ */
+t_gopts	*glob_options(void)
+{
+	static t_gopts	options;
+
+	return (&options);
+}